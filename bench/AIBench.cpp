@@ -0,0 +1,100 @@
+// AI attack selection and state decisions for one controller tick
+
+#include "Bench.h"
+#include "AIConfig.h"
+#include "AIDecisionMaker.h"
+#include "AIExecutor.h"
+#include "EnhancedAIState.h"
+#include "character/Character.h"
+#include "Platform.h"
+#include "Random.h"
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Two characters on the default stage floor, distance apart
+    struct Matchup
+    {
+        std::vector<Platform> platforms;
+        PlatformGrid grid;
+        Character player;
+        Character enemy;
+
+        explicit Matchup(float distance)
+            : player(640 - distance / 2, 580, 50, 80, 5.0f, RED, "Player"),
+              enemy(640 + distance / 2, 580, 50, 80, 5.0f, BLUE, "Enemy")
+        {
+            platforms.push_back(Platform(340, 620, 600, 50, DARKGRAY, SOLID));
+            platforms.push_back(Platform(390, 470, 150, 20, GRAY, PASSTHROUGH));
+            platforms.push_back(Platform(740, 470, 150, 20, GRAY, PASSTHROUGH));
+            platforms.push_back(Platform(565, 320, 150, 20, GRAY, PASSTHROUGH));
+            grid.build(platforms);
+            for (int i = 0; i < 60; i++)
+            {
+                player.update(platforms, grid);
+                enemy.update(platforms, grid);
+            }
+        }
+    };
+
+    void benchChooseBestAttack(BenchState& state, float distance)
+    {
+        RandomStreams streams(3);
+        RandomScope randomScope(streams);
+
+        Matchup matchup(distance);
+        AIConfig config(0.8f);
+        AIExecutor executor(config);
+        executor.SetPlatforms(&matchup.platforms);
+
+        float distanceX = matchup.player.physics.position.x - matchup.enemy.physics.position.x;
+        float distanceY = matchup.player.physics.position.y - matchup.enemy.physics.position.y;
+        while (state.keepRunning())
+        {
+            int attack = executor.ChooseBestAttack(&matchup.enemy, &matchup.player, distanceX, distanceY);
+            doNotOptimize(attack);
+        }
+    }
+
+    // Full decision pass; the state timer is held past the reaction delay so
+    // the early-out never fires
+    void benchDetermineNextAction(BenchState& state, float distance)
+    {
+        RandomStreams streams(3);
+        RandomScope randomScope(streams);
+
+        Matchup matchup(distance);
+        AIConfig config(0.8f);
+        AIDecisionMaker decisionMaker(config);
+        EnhancedAIState aiState;
+        for (int frame = 0; frame < 60; frame += 5)
+        {
+            aiState.UpdateState(&matchup.enemy, &matchup.player, frame);
+        }
+
+        std::vector<Character*> players = {&matchup.player, &matchup.enemy};
+        while (state.keepRunning())
+        {
+            aiState.stateTimer = 1000;
+            decisionMaker.DetermineNextAction(players, matchup.platforms, aiState);
+        }
+        doNotOptimize(aiState.GetCurrentState());
+    }
+
+    void registerAll()
+    {
+        for (int distance : {60, 300})
+        {
+            registerBench("AIExecutor::ChooseBestAttack/distance:" + std::to_string(distance),
+                          [distance](BenchState& state) { benchChooseBestAttack(state, static_cast<float>(distance)); });
+        }
+        for (int distance : {60, 300})
+        {
+            registerBench("AIDecisionMaker::DetermineNextAction/distance:" + std::to_string(distance),
+                          [distance](BenchState& state) { benchDetermineNextAction(state, static_cast<float>(distance)); });
+        }
+    }
+
+    BenchRegistrar registrar(registerAll);
+}
@@ -0,0 +1,84 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Minimal microbenchmark harness for vibester_bench.
+//
+// A benchmark body does its setup, then times the loop:
+//
+//     while (state.keepRunning())
+//     {
+//         ... one operation ...
+//     }
+//
+// The runner picks the iteration count, repeats the run and reports the
+// median ns/op and heap allocations/op.
+class BenchState
+{
+public:
+    explicit BenchState(int64_t iterations);
+
+    // Loop condition; the clock and allocation counter run from the first call to the last
+    bool keepRunning();
+
+    // Exclude per-run resets from the measurement
+    void pauseTiming();
+    void resumeTiming();
+
+    // Work items processed per operation (particles, platforms, ...), for ns/item
+    void setItemsPerOp(int64_t items) { itemsPerOp = items; }
+
+    int64_t getIterations() const { return iterations; }
+    int64_t getItemsPerOp() const { return itemsPerOp; }
+    double getElapsedNanos() const { return elapsedNanos; }
+    uint64_t getAllocations() const { return allocations; }
+
+private:
+    int64_t iterations;
+    int64_t remaining;
+    int64_t itemsPerOp;
+    bool running;
+    int64_t startNanos;
+    uint64_t startAllocations;
+    double elapsedNanos;
+    uint64_t allocations;
+};
+
+struct BenchCase {
+    std::string name;
+    std::function<void(BenchState&)> run;
+};
+
+// Every registered benchmark, in registration order within each file
+std::vector<BenchCase>& benchRegistry();
+
+inline void registerBench(const std::string& name, std::function<void(BenchState&)> run)
+{
+    benchRegistry().push_back({name, run});
+}
+
+// Registers benchmarks from a namespace-scope object, before main() runs
+struct BenchRegistrar {
+    explicit BenchRegistrar(void (*registerAll)()) { registerAll(); }
+};
+
+// Heap allocations made by this process so far (counted by the runner's operator new)
+uint64_t allocationCount();
+
+// Keeps the optimizer from discarding a result
+template <typename T>
+inline void doNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+#endif // BENCH_H
@@ -0,0 +1,293 @@
+// vibester_bench: repeatable microbenchmarks for the simulation hot paths.
+//
+// Usage: vibester_bench [--filter text] [--min-time seconds] [--repetitions N]
+//                       [--json file] [--csv file]
+//
+// Build in Release for numbers worth comparing; the JSON records whether the
+// frame profiler was compiled in.
+
+#include "Bench.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace
+{
+    std::atomic<uint64_t> allocations(0);
+
+    int64_t nowNanos()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    struct Options {
+        std::string filter;
+        double minTime = 0.2;
+        int repetitions = 5;
+        std::string jsonPath;
+        std::string csvPath;
+    };
+
+    struct BenchResult {
+        std::string name;
+        int64_t iterations;
+        int64_t itemsPerOp;
+        double nsPerOp;      // Median over the repetitions
+        double nsPerOpMin;
+        double allocsPerOp;
+    };
+
+    bool parseOptions(int argc, char** argv, Options& options)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            std::string name = argv[i];
+            if (i + 1 >= argc)
+            {
+                std::cerr << "Missing value for " << name << std::endl;
+                return false;
+            }
+
+            std::string value = argv[++i];
+            if (name == "--filter") options.filter = value;
+            else if (name == "--min-time") options.minTime = std::atof(value.c_str());
+            else if (name == "--repetitions") options.repetitions = std::atoi(value.c_str());
+            else if (name == "--json") options.jsonPath = value;
+            else if (name == "--csv") options.csvPath = value;
+            else
+            {
+                std::cerr << "Unknown option " << name << std::endl;
+                return false;
+            }
+        }
+
+        if (options.minTime <= 0.0 || options.repetitions <= 0)
+        {
+            std::cerr << "Invalid timing settings" << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    BenchState runOnce(const BenchCase& bench, int64_t iterations)
+    {
+        BenchState state(iterations);
+        bench.run(state);
+        return state;
+    }
+
+    BenchResult runBench(const BenchCase& bench, const Options& options)
+    {
+        // Grow the iteration count until one run takes a measurable slice of the budget
+        int64_t iterations = 1;
+        BenchState probe = runOnce(bench, iterations);
+        while (probe.getElapsedNanos() < options.minTime * 1e9 / 10 && iterations < (int64_t(1) << 40))
+        {
+            double perOp = std::max(probe.getElapsedNanos() / iterations, 1.0);
+            int64_t target = static_cast<int64_t>(options.minTime * 1e9 / perOp);
+            iterations = std::max(iterations * 2, std::min(target, iterations * 100));
+            probe = runOnce(bench, iterations);
+        }
+
+        std::vector<double> nsPerOp;
+        double allocsPerOp = 0.0;
+        int64_t itemsPerOp = 1;
+        for (int r = 0; r < options.repetitions; r++)
+        {
+            BenchState state = runOnce(bench, iterations);
+            nsPerOp.push_back(state.getElapsedNanos() / iterations);
+            allocsPerOp = static_cast<double>(state.getAllocations()) / iterations;
+            itemsPerOp = state.getItemsPerOp();
+        }
+
+        std::sort(nsPerOp.begin(), nsPerOp.end());
+        return {bench.name, iterations, itemsPerOp, nsPerOp[nsPerOp.size() / 2], nsPerOp.front(), allocsPerOp};
+    }
+
+    std::string jsonEscape(const std::string& text)
+    {
+        std::string out;
+        for (char c : text)
+        {
+            if (c == '"' || c == '\\') out += '\\';
+            out += c;
+        }
+        return out;
+    }
+
+    void writeJson(std::ostream& out, const std::vector<BenchResult>& results, const Options& options)
+    {
+        out << "{\n  \"profiler\": " << VIBESTER_PROFILE << ",\n  \"repetitions\": " << options.repetitions
+            << ",\n  \"benchmarks\": [\n";
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const BenchResult& r = results[i];
+            out << "    {\"name\": \"" << jsonEscape(r.name) << "\", \"iterations\": " << r.iterations
+                << ", \"items_per_op\": " << r.itemsPerOp << ", \"ns_per_op\": " << r.nsPerOp
+                << ", \"ns_per_op_min\": " << r.nsPerOpMin << ", \"allocs_per_op\": " << r.allocsPerOp << "}"
+                << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        out << "  ]\n}\n";
+    }
+
+    void writeCsv(std::ostream& out, const std::vector<BenchResult>& results)
+    {
+        out << "name,iterations,items_per_op,ns_per_op,ns_per_op_min,allocs_per_op\n";
+        for (const BenchResult& r : results)
+        {
+            out << r.name << "," << r.iterations << "," << r.itemsPerOp << "," << r.nsPerOp << ","
+                << r.nsPerOpMin << "," << r.allocsPerOp << "\n";
+        }
+    }
+}
+
+// Count every heap allocation in the process
+void* operator new(std::size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1))
+    {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept
+{
+    return operator new(size, tag);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+uint64_t allocationCount()
+{
+    return allocations.load(std::memory_order_relaxed);
+}
+
+std::vector<BenchCase>& benchRegistry()
+{
+    static std::vector<BenchCase> registry;
+    return registry;
+}
+
+BenchState::BenchState(int64_t iterationCount)
+    : iterations(iterationCount), remaining(iterationCount), itemsPerOp(1), running(false),
+      startNanos(0), startAllocations(0), elapsedNanos(0.0), allocations(0)
+{
+}
+
+bool BenchState::keepRunning()
+{
+    if (remaining == iterations && !running && elapsedNanos == 0.0)
+    {
+        resumeTiming();
+    }
+
+    if (remaining-- > 0)
+    {
+        return true;
+    }
+
+    pauseTiming();
+    return false;
+}
+
+void BenchState::pauseTiming()
+{
+    if (!running)
+    {
+        return;
+    }
+
+    elapsedNanos += static_cast<double>(nowNanos() - startNanos);
+    allocations += allocationCount() - startAllocations;
+    running = false;
+}
+
+void BenchState::resumeTiming()
+{
+    if (running)
+    {
+        return;
+    }
+
+    startAllocations = allocationCount();
+    startNanos = nowNanos();
+    running = true;
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        return 1;
+    }
+
+    std::vector<BenchResult> results;
+    std::printf("%-48s %14s %12s %10s %12s\n", "benchmark", "iterations", "ns/op", "ns/item", "allocs/op");
+    for (const BenchCase& bench : benchRegistry())
+    {
+        if (!options.filter.empty() && bench.name.find(options.filter) == std::string::npos)
+        {
+            continue;
+        }
+
+        BenchResult r = runBench(bench, options);
+        results.push_back(r);
+        std::printf("%-48s %14lld %12.1f %10.2f %12.2f\n", r.name.c_str(), static_cast<long long>(r.iterations),
+                    r.nsPerOp, r.nsPerOp / r.itemsPerOp, r.allocsPerOp);
+        std::fflush(stdout);
+    }
+
+    if (!options.jsonPath.empty())
+    {
+        std::ofstream file(options.jsonPath);
+        writeJson(file, results, options);
+    }
+    if (!options.csvPath.empty())
+    {
+        std::ofstream file(options.csvPath);
+        writeCsv(file, results);
+    }
+
+    return 0;
+}
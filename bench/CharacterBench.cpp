@@ -0,0 +1,185 @@
+// Character::update against growing stages, checkHit against growing hitbox
+// counts, the hit broadphase against growing player counts and the projectile
+// pool against growing projectile counts
+
+#include "Bench.h"
+#include "character/Character.h"
+#include "Platform.h"
+#include "HitBroadphase.h"
+#include "MovingPlatforms.h"
+#include "ProjectilePool.h"
+#include "Random.h"
+#include <string>
+#include <vector>
+
+namespace
+{
+    const int SETTLE_TICKS = 120;
+
+    // A solid floor under the character plus platformCount - 1 passthrough
+    // platforms spread over the rest of the stage, none of them in reach
+    std::vector<Platform> buildStage(int platformCount)
+    {
+        std::vector<Platform> platforms;
+        platforms.push_back(Platform(100, 600, 1000, 50, DARKGRAY, SOLID));
+        for (int i = 1; i < platformCount; i++)
+        {
+            float x = -4000.0f + (i % 64) * 130.0f;
+            float y = -3000.0f - (i / 64) * 60.0f;
+            platforms.push_back(Platform(x, y, 100, 20, GRAY, PASSTHROUGH));
+        }
+        return platforms;
+    }
+
+    // Idle character standing on the floor; update() reaches a steady state
+    // after landing, so every timed tick does the same work
+    void benchCharacterUpdate(BenchState& state, int platformCount)
+    {
+        RandomStreams streams(1);
+        RandomScope randomScope(streams);
+
+        std::vector<Platform> platforms = buildStage(platformCount);
+        PlatformGrid grid;
+        grid.build(platforms);
+        Character character(600, 540, 50, 80, 5.0f, RED, "Bench");
+        for (int i = 0; i < SETTLE_TICKS; i++)
+        {
+            character.update(platforms, grid);
+        }
+
+        state.setItemsPerOp(platformCount);
+        while (state.keepRunning())
+        {
+            character.update(platforms, grid);
+        }
+        doNotOptimize(character.physics.position);
+    }
+
+    // Attacker with hitboxCount active boxes that all miss the defender,
+    // so the loop measures the overlap tests rather than hit resolution
+    void benchCheckHit(BenchState& state, int hitboxCount)
+    {
+        RandomStreams streams(1);
+        RandomScope randomScope(streams);
+
+        Character attacker(200, 300, 50, 80, 5.0f, RED, "Attacker");
+        Character defender(900, 300, 50, 80, 5.0f, BLUE, "Defender");
+        for (int i = 0; i < hitboxCount; i++)
+        {
+            Rectangle rect = {150.0f + (i % 8) * 10.0f, 250.0f + (i / 8) * 5.0f, 40, 30};
+            attacker.attacks.push_back(AttackBox(rect, 5.0f, 3.0f, 0.1f, 45.0f, 10, 5));
+        }
+
+        state.setItemsPerOp(hitboxCount);
+        while (state.keepRunning())
+        {
+            bool hit = attacker.checkHit(defender);
+            doNotOptimize(hit);
+        }
+    }
+
+    // playerCount players spread along a wide stage on four levels, each with a
+    // hurtbox and HITBOXES_PER_PLAYER boxes ahead of it (a melee box plus
+    // projectiles in flight), so neighbours hit each other and the rest do not
+    void benchHitBroadphase(BenchState& state, int playerCount)
+    {
+        const int HITBOXES_PER_PLAYER = 4;
+        HitBroadphase broadphase;
+        size_t pairs = 0;
+
+        state.setItemsPerOp(playerCount * (HITBOXES_PER_PLAYER + 1));
+        while (state.keepRunning())
+        {
+            broadphase.clear();
+            for (int player = 0; player < playerCount; player++)
+            {
+                float x = player * 100.0f;
+                float y = (player % 4) * 120.0f;
+                broadphase.addHurtbox(player, {x - 25, y - 40, 50, 80});
+                for (int box = 0; box < HITBOXES_PER_PLAYER; box++)
+                {
+                    broadphase.addHitbox(player, box, {x + 30 + box * 40.0f, y - 10, 40, 20});
+                }
+            }
+            pairs += broadphase.findPairs().size();
+        }
+        doNotOptimize(pairs);
+    }
+
+    // projectileCount neutral-special projectiles crossing the stage both ways.
+    // Each op tops the pool back up, so it includes spawning the ones that
+    // expired or left through a blast zone as well as the update itself.
+    void benchProjectileUpdate(BenchState& state, int projectileCount)
+    {
+        ProjectilePool projectiles(projectileCount);
+        ProjectileHit hit = {8.0f, 3.0f, 0.1f, 0.0f, 15, 0};
+        int spawned = 0;
+
+        state.setItemsPerOp(projectileCount);
+        while (state.keepRunning())
+        {
+            while (projectiles.size() < projectileCount)
+            {
+                bool right = spawned % 2 == 0;
+                float y = 100.0f + (spawned % 16) * 30.0f;
+                projectiles.spawn(spawned % 8, {right ? 100.0f : 1100.0f, y, 25, 25},
+                                  {right ? 24.0f : -24.0f, 0.0f}, 30 + spawned % 30, hit);
+                spawned++;
+            }
+            projectiles.update();
+        }
+        doNotOptimize(spawned);
+    }
+
+    // platformCount platforms shuttling side to side and up and down at
+    // different speeds, so some turn back on any given tick
+    void benchMovingPlatformUpdate(BenchState& state, int platformCount)
+    {
+        std::vector<Platform> platforms = buildStage(platformCount);
+        MovingPlatforms moving;
+        for (int i = 0; i < platformCount; i++)
+        {
+            const Rectangle& rect = platforms[i].rect;
+            Vector2 end = i % 2 == 0 ? Vector2{rect.x + 200.0f, rect.y} : Vector2{rect.x, rect.y - 150.0f};
+            moving.add(i, platforms, end, 1.0f + i % 5);
+        }
+
+        state.setItemsPerOp(platformCount);
+        while (state.keepRunning())
+        {
+            moving.update(platforms);
+        }
+        doNotOptimize(platforms[0].rect);
+    }
+
+    void registerAll()
+    {
+        for (int platforms : {4, 64, 512})
+        {
+            registerBench("Character::update/platforms:" + std::to_string(platforms),
+                          [platforms](BenchState& state) { benchCharacterUpdate(state, platforms); });
+        }
+        for (int boxes : {1, 8, 64})
+        {
+            registerBench("Character::checkHit/hitboxes:" + std::to_string(boxes),
+                          [boxes](BenchState& state) { benchCheckHit(state, boxes); });
+        }
+        for (int players : {8, 64, 256})
+        {
+            registerBench("HitBroadphase/players:" + std::to_string(players),
+                          [players](BenchState& state) { benchHitBroadphase(state, players); });
+        }
+        for (int count : {64, 1024, 16384})
+        {
+            registerBench("ProjectilePool::update/projectiles:" + std::to_string(count),
+                          [count](BenchState& state) { benchProjectileUpdate(state, count); });
+        }
+        for (int platforms : {16, 64, 1024})
+        {
+            registerBench("MovingPlatforms::update/platforms:" + std::to_string(platforms),
+                          [platforms](BenchState& state) { benchMovingPlatformUpdate(state, platforms); });
+        }
+    }
+
+    BenchRegistrar registrar(registerAll);
+}
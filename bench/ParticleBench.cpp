@@ -0,0 +1,236 @@
+// Particle stepping and explosion spawning
+
+#include "Bench.h"
+#include "Particle.h"
+#include "ParticleSystem.h"
+#include "ParticlePool.h"
+#include "ParticleKernel.h"
+#include "ParticleEmitter.h"
+#include "Random.h"
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Size and drag decay geometrically; restoring the population this often
+    // keeps them clear of denormals, which would otherwise dominate long runs
+    const int PASSES_PER_RESET = 256;
+
+    // Lifespans far beyond any run length, so the population stays fixed
+    // and each timed pass updates exactly count particles
+    std::vector<Particle> buildParticles(int count)
+    {
+        RandomStreams streams(7);
+        RandomScope randomScope(streams);
+
+        std::vector<Particle> particles;
+        particles.reserve(count);
+        for (int i = 0; i < count; i++)
+        {
+            Vector2 position = {static_cast<float>(cosmeticRandom(0, 1280)), static_cast<float>(cosmeticRandom(0, 720))};
+            Vector2 velocity = {cosmeticRandom(-50, 50) / 10.0f, cosmeticRandom(-50, 50) / 10.0f};
+            particles.push_back(Particle(position, velocity, 4.0f, 1 << 30, ORANGE));
+        }
+        return particles;
+    }
+
+    void benchParticleUpdate(BenchState& state, int count)
+    {
+        const std::vector<Particle> initial = buildParticles(count);
+        std::vector<Particle> particles = initial;
+
+        state.setItemsPerOp(count);
+        int passes = 0;
+        while (state.keepRunning())
+        {
+            if (++passes == PASSES_PER_RESET)
+            {
+                state.pauseTiming();
+                particles = initial;
+                passes = 0;
+                state.resumeTiming();
+            }
+
+            for (auto& particle : particles)
+            {
+                particle.update();
+            }
+        }
+        doNotOptimize(particles[0].position);
+    }
+
+    void benchUpdateParticles(BenchState& state, int count)
+    {
+        const std::vector<Particle> initial = buildParticles(count);
+        std::vector<Particle> particles = initial;
+
+        state.setItemsPerOp(count);
+        int passes = 0;
+        while (state.keepRunning())
+        {
+            if (++passes == PASSES_PER_RESET)
+            {
+                state.pauseTiming();
+                particles = initial;
+                passes = 0;
+                state.resumeTiming();
+            }
+
+            bool alive = updateParticles(particles);
+            doNotOptimize(alive);
+        }
+    }
+
+    // Integration kernel at a given instruction set, against updateParticles above
+    void benchPoolUpdate(BenchState& state, int count, ParticleKernel::Level level)
+    {
+        ParticleKernel::Level previous = ParticleKernel::getLevel();
+        ParticleKernel::setLevel(level);
+
+        ParticlePool initial(count);
+        initial.spawn(buildParticles(count));
+        ParticlePool pool = initial;
+
+        state.setItemsPerOp(count);
+        int passes = 0;
+        while (state.keepRunning())
+        {
+            if (++passes == PASSES_PER_RESET)
+            {
+                state.pauseTiming();
+                pool = initial;
+                passes = 0;
+                state.resumeTiming();
+            }
+
+            pool.update();
+        }
+        doNotOptimize(pool.positionX()[0]);
+
+        ParticleKernel::setLevel(previous);
+    }
+
+    // Steady state with churn: a sixteenth of the particles expire and respawn every tick.
+    // Spawned as gameplay particles, the only priority allowed the whole budget
+    void benchPoolChurn(BenchState& state, int count)
+    {
+        RandomStreams streams(7);
+        RandomScope randomScope(streams);
+
+        ParticlePool pool(count);
+        for (int i = 0; i < count; i++)
+        {
+            pool.spawn({640, 360}, {cosmeticRandom(-50, 50) / 10.0f, -2.0f}, 4.0f, 1 + i % 16, ORANGE,
+                       BLEND_ALPHA, PRIORITY_GAMEPLAY);
+        }
+
+        state.setItemsPerOp(count);
+        while (state.keepRunning())
+        {
+            pool.update();
+            while (pool.size() < count)
+            {
+                if (!pool.spawn({640, 360}, {1.0f, -2.0f}, 4.0f, 16, ORANGE, BLEND_ALPHA, PRIORITY_GAMEPLAY))
+                {
+                    break;
+                }
+            }
+        }
+        doNotOptimize(pool.positionX()[0]);
+    }
+
+    // One death explosion's worth of particles per op, including the vector it returns
+    void benchCreateExplosion(BenchState& state, int count)
+    {
+        RandomStreams streams(7);
+        RandomScope randomScope(streams);
+
+        state.setItemsPerOp(count);
+        while (state.keepRunning())
+        {
+            std::vector<Particle> particles = createExplosionParticles({640, 360}, count, ORANGE);
+            doNotOptimize(particles.data());
+        }
+    }
+
+    // The same burst through the emitter, straight into a pool
+    void benchEmit(BenchState& state, const EmitterDesc& burst, int count)
+    {
+        RandomStreams streams(7);
+        RandomScope randomScope(streams);
+
+        EmitterDesc desc = burst;
+        desc.count = count;
+        ParticlePool pool(count);
+
+        state.setItemsPerOp(count);
+        while (state.keepRunning())
+        {
+            pool.clear();
+            ParticleEmitter::emit(pool, desc, {640, 360}, ORANGE);
+        }
+        doNotOptimize(pool.positionX()[0]);
+    }
+
+    // A baked burst: one bulk copy per layer instead of generating every particle
+    void benchBurstTemplate(BenchState& state, const BurstTemplate& burst)
+    {
+        RandomStreams streams(7);
+        RandomScope randomScope(streams);
+
+        ParticlePool pool(burst.size());
+
+        state.setItemsPerOp(burst.size());
+        while (state.keepRunning())
+        {
+            pool.clear();
+            burst.spawn(pool, {640, 360}, ORANGE);
+        }
+        doNotOptimize(pool.positionX()[0]);
+    }
+
+    void registerAll()
+    {
+        for (int count : {1000, 10000, 100000})
+        {
+            registerBench("Particle::update/particles:" + std::to_string(count),
+                          [count](BenchState& state) { benchParticleUpdate(state, count); });
+        }
+        for (int count : {1000, 10000, 100000})
+        {
+            registerBench("updateParticles/particles:" + std::to_string(count),
+                          [count](BenchState& state) { benchUpdateParticles(state, count); });
+        }
+        // Only the levels this CPU can run
+        for (int level = ParticleKernel::SCALAR; level <= ParticleKernel::detectLevel(); level++)
+        {
+            ParticleKernel::Level kernel = static_cast<ParticleKernel::Level>(level);
+            for (int count : {1000, 10000, 100000})
+            {
+                registerBench("ParticlePool::update/" + std::string(ParticleKernel::levelName(kernel)) +
+                                  "/particles:" + std::to_string(count),
+                              [count, kernel](BenchState& state) { benchPoolUpdate(state, count, kernel); });
+            }
+        }
+        for (int count : {10000, 100000})
+        {
+            registerBench("ParticlePool::update+respawn/particles:" + std::to_string(count),
+                          [count](BenchState& state) { benchPoolChurn(state, count); });
+        }
+        for (int count : {50, 200})
+        {
+            registerBench("createExplosionParticles/particles:" + std::to_string(count),
+                          [count](BenchState& state) { benchCreateExplosion(state, count); });
+            registerBench("ParticleEmitter::emit/explosion/particles:" + std::to_string(count),
+                          [count](BenchState& state) { benchEmit(state, Emitters::EXPLOSION, count); });
+        }
+        registerBench("ParticleEmitter::emit/explosion_burst/particles:150",
+                      [](BenchState& state) { benchEmit(state, Emitters::EXPLOSION_BURST, 150); });
+        registerBench("BurstTemplate::spawn/explosion",
+                      [](BenchState& state) { benchBurstTemplate(state, BurstTemplates::explosion()); });
+        registerBench("BurstTemplate::spawn/massive_explosion",
+                      [](BenchState& state) { benchBurstTemplate(state, BurstTemplates::massiveExplosion()); });
+    }
+
+    BenchRegistrar registrar(registerAll);
+}
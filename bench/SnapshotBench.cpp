@@ -0,0 +1,134 @@
+// Measures world snapshot size and save/restore cost on a mid-match AI-vs-AI
+// world, sampled mid-explosion so the effects are part of it.
+//
+// Usage: snapshot_bench [iterations]
+
+#include "World.h"
+#include "Snapshot.h"
+#include "GameConfig.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+    const uint64_t BENCH_SEED = 0x5EEDF00DULL;
+    const int WARMUP_FRAMES = 600;
+    const int VERIFY_FRAMES = 120;
+
+    // Frames after an explosion starts to sample at: its particle trail is
+    // still being emitted and the shockwave is still growing
+    const int EXPLOSION_FRAMES = 15;
+
+    // Both slots busy so the snapshot carries attacks and AI history
+    std::vector<PlayerInput> scriptedInputs(int frame)
+    {
+        std::vector<PlayerInput> inputs(2);
+        uint16_t buttons = (frame / 45) % 2 == 0 ? InputButton::RIGHT : InputButton::LEFT;
+        if (frame % 20 < 2) buttons |= InputButton::ATTACK;
+        if (frame % 90 < 2) buttons |= InputButton::UP;
+        inputs[0].buttons = buttons;
+        return inputs;
+    }
+
+    void buildWorld(World& world)
+    {
+        ReplayHeader header;
+        header.seed = BENCH_SEED;
+        header.playerCount = 2;
+        header.stockCount = 3;
+        header.aiEnabled = true;
+        header.aiDifficulty = 0.8f;
+        world.initFromReplay(header);
+    }
+
+    double microsecondsSince(std::chrono::steady_clock::time_point start, int iterations)
+    {
+        std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / iterations;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int iterations = argc > 1 ? std::atoi(argv[1]) : 100000;
+    if (iterations <= 0)
+    {
+        std::fprintf(stderr, "usage: %s [iterations]\n", argv[0]);
+        return 1;
+    }
+
+    World world;
+    buildWorld(world);
+    for (int frame = 0; frame < WARMUP_FRAMES; frame++)
+    {
+        world.step(scriptedInputs(world.frame));
+    }
+
+    // Push the AI past the threshold; its next update turns that into an explosion
+    world.players[1]->damagePercent = EXPLOSION_DAMAGE_THRESHOLD;
+    for (int frame = 0; frame < EXPLOSION_FRAMES; frame++)
+    {
+        world.step(scriptedInputs(world.frame));
+    }
+    if (world.vfx.particles.size() == 0)
+    {
+        std::fprintf(stderr, "no explosion in progress; the snapshot would be near empty\n");
+        return 1;
+    }
+
+    std::vector<uint8_t> buffer;
+    Snapshot::save(world, buffer);
+
+    // Round trip check: stepping after a restore must reproduce the same state
+    std::vector<uint8_t> expected, actual;
+    for (int frame = 0; frame < VERIFY_FRAMES; frame++)
+    {
+        world.step(scriptedInputs(world.frame));
+    }
+    Snapshot::save(world, expected);
+
+    if (!Snapshot::restore(world, buffer))
+    {
+        std::fprintf(stderr, "restore rejected its own snapshot\n");
+        return 1;
+    }
+    for (int frame = 0; frame < VERIFY_FRAMES; frame++)
+    {
+        world.step(scriptedInputs(world.frame));
+    }
+    Snapshot::save(world, actual);
+
+    if (actual != expected)
+    {
+        std::fprintf(stderr, "restored world diverged after %d frames\n", VERIFY_FRAMES);
+        return 1;
+    }
+
+    // Timings; the buffer keeps its capacity so steady-state saves do not allocate
+    Snapshot::restore(world, buffer);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+    {
+        Snapshot::save(world, buffer);
+    }
+    double saveMicros = microsecondsSince(start, iterations);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+    {
+        Snapshot::restore(world, buffer);
+    }
+    double restoreMicros = microsecondsSince(start, iterations);
+
+    std::printf("frame:        %d\n", world.frame);
+    std::printf("particles:    %d\n", world.vfx.particles.size());
+    std::printf("size:         %zu bytes\n", buffer.size());
+    std::printf("save:         %.3f us\n", saveMicros);
+    std::printf("restore:      %.3f us\n", restoreMicros);
+    std::printf("round trip:   ok (%d frames)\n", VERIFY_FRAMES);
+
+    return 0;
+}
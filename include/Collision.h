@@ -0,0 +1,81 @@
+#ifndef COLLISION_H
+#define COLLISION_H
+
+#include "raylib.h"
+#include "Platform.h"
+#include "PlatformGrid.h"
+#include "Real.h"
+#include <vector>
+
+// Axis-aligned rectangle overlap test used by the simulation core.
+// Same semantics as raylib's CheckCollisionRecs, kept local so the core does not
+// call into the windowing library.
+inline bool rectsOverlap(Rect a, Rect b)
+{
+    return a.x < b.x + b.width && a.x + a.width > b.x &&
+        a.y < b.y + b.height && a.y + a.height > b.y;
+}
+
+// Where a box ended up after a sweep through the platforms and what stopped it
+struct PlatformContact
+{
+    Vec2 position;      // Final centre of the box
+    bool landed;        // Stopped by a platform top while moving down
+    bool blockedX;      // Stopped by the side of a SOLID platform
+    int ground;         // Index of the platform landed on, -1 if none
+};
+
+// Move a box of the given size, centred on position, by delta through the
+// platforms near it. The box travels to the earliest platform face in its
+// path, stops on that axis and slides along the other with whatever movement
+// is left, so it cannot tunnel through a platform however fast it moves.
+//
+// Tops stop a box moving down on both platform types; a box whose feet are
+// already in the upper half of a SOLID platform is lifted onto it. SOLID
+// sides stop horizontal movement unless the box is within 5 units of the top
+// (so it can walk onto a platform it stands level with). Bottoms never block:
+// characters jump up through SOLID platforms as well as PASSTHROUGH ones.
+//
+// Moving platforms (see MovingPlatforms) have already taken this tick's step.
+// The box is swept against each of them in that platform's own frame, so a
+// platform rising into a falling box catches it however fast either moves.
+// ground is the platform the box stood on after its last sweep; if that one
+// moves, it carries the box along with its own move, and the box stays on it.
+PlatformContact sweepPlatforms(Vec2 position, float width, float height, Vec2 delta,
+                               const std::vector<Platform>& platforms, const PlatformGrid& grid,
+                               int ground = -1);
+
+// Platform collision for every character of a tick in one pass.
+// Boxes and moves are added into flat arrays, resolve() sweeps them all with
+// the same rules as sweepPlatforms, and each character then applies its
+// contact (landing, stopping against walls) by itself.
+class CollisionBatch
+{
+public:
+    void clear();
+
+    // Returns the slot whose contact() this box gets; ground as for sweepPlatforms
+    int add(Vec2 position, float width, float height, Vec2 delta, int ground = -1);
+
+    void resolve(const std::vector<Platform>& platforms, const PlatformGrid& grid);
+
+    int size() const { return static_cast<int>(positionX.size()); }
+    const PlatformContact& contact(int slot) const { return contacts[slot]; }
+
+private:
+    std::vector<Real> positionX;
+    std::vector<Real> positionY;
+    std::vector<Real> halfWidth;
+    std::vector<Real> halfHeight;
+    std::vector<Real> deltaX;
+    std::vector<Real> deltaY;
+    std::vector<int> ground;
+
+    // Each box swept over its whole move, the area its candidates come from
+    std::vector<Rectangle> swept;
+
+    std::vector<PlatformContact> contacts;
+    std::vector<int> candidates;
+};
+
+#endif // COLLISION_H
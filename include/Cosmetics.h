@@ -0,0 +1,24 @@
+#ifndef COSMETICS_H
+#define COSMETICS_H
+
+// Switches cosmetic-only output (explosion particles, hit flashes) on or off
+// for the calling thread while the scope is alive.
+// Rollback re-simulates frames that were already shown, so it turns cosmetics
+// off for those ticks: no effects are added and the live ones hold still.
+// Nothing that affects gameplay checks this flag.
+class CosmeticsScope {
+public:
+    explicit CosmeticsScope(bool enabled);
+    ~CosmeticsScope();
+
+    CosmeticsScope(const CosmeticsScope&) = delete;
+    CosmeticsScope& operator=(const CosmeticsScope&) = delete;
+
+private:
+    bool previous;
+};
+
+// True unless a CosmeticsScope on this thread has turned cosmetics off
+bool cosmeticsEnabled();
+
+#endif // COSMETICS_H
@@ -6,8 +6,12 @@
 #include "AIDecisionMaker.h"
 #include "AIExecutor.h"
 #include "AIConfig.h"
+#include "HitEvent.h"
 #include <memory>
 
+class SnapshotWriter;
+class SnapshotReader;
+
 class EnhancedAIController : public IAIController {
 public:
     EnhancedAIController();
@@ -19,9 +23,18 @@ public:
     float GetDifficulty() const override;
 
     // Additional methods for the Enhanced AI
+    void SetConfig(const AIConfig& newConfig);
+    void SetPlayerSlots(int controlledSlot, int opponentSlot);
     EnhancedAIState::State GetCurrentState() const;
     float GetCurrentConfidence() const;
 
+    // Called by World for every hit resolved in a tick
+    void OnHit(const HitEvent& hit);
+
+    // Save states (see Snapshot.h)
+    void SaveSnapshot(SnapshotWriter& writer) const;
+    void RestoreSnapshot(SnapshotReader& reader);
+
 private:
     // Core AI components
     std::unique_ptr<EnhancedAIState> aiState;
@@ -29,6 +42,11 @@ private:
     std::unique_ptr<AIExecutor> executor;
     AIConfig config;
 
+    // Which players[] entries this AI drives and fights
+    int controlledIndex;
+    int opponentIndex;
+    std::vector<Character*> matchup; // {opponent, controlled}, the layout the decision maker expects
+
     // Tracking variables
     int frameCount;
     bool wasComboEffective;
@@ -36,6 +54,7 @@ private:
     float lastDIEffectiveness;
 
     // Helper methods
+    void ApplyConfig();
     void ExecuteComboBehavior(Character* enemy, Character* player, float distanceX, float distanceY);
     bool IsOffStage(Vector2 position, const std::vector<Platform>& platforms);
 };
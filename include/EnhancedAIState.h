@@ -9,6 +9,8 @@
 
 class Character;
 struct Vector2;
+class SnapshotWriter;
+class SnapshotReader;
 
 class EnhancedAIState : public IAIState {
 public:
@@ -42,8 +44,8 @@ public:
     // IAIState interface implementation
     void UpdateState(Character* enemy, Character* player, int frameCount) override;
     void AnalyzePlayerPatterns() override;
-    bool DetectPlayerHabit(const std::deque<CharacterState>& history,
-                          CharacterState state,
+    bool DetectPlayerHabit(const std::deque<CharacterState::State>& history,
+                          CharacterState::State state,
                           float threshold) override;
 
     // State accessors
@@ -104,6 +106,10 @@ public:
     // Update player behavior profiles
     void UpdatePlayerBehaviorProfiles();
 
+    // Save states (see Snapshot.h)
+    void SaveSnapshot(SnapshotWriter& writer) const;
+    void RestoreSnapshot(SnapshotReader& reader);
+
     // Player pattern analysis
     float playerAggressionLevel;
     float playerDefenseLevel;
@@ -123,7 +129,7 @@ public:
     // History tracking
     std::deque<int> lastPlayerAttacks;
     std::deque<std::pair<Vector2, int>> playerPositionHistory;
-    std::deque<CharacterState> playerStateHistory;
+    std::deque<CharacterState::State> playerStateHistory;
 
 private:
     State currentState;
@@ -0,0 +1,115 @@
+#ifndef FIXED_H
+#define FIXED_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+// Q16.16 fixed-point number: an int32 counting 1/65536ths.
+// Every operation on two Fixed values is integer arithmetic, so results are
+// the same bit for bit on any compiler, CPU or optimisation level. Floats do
+// not promise that: FMA contraction, -ffast-math, x87 excess precision and
+// libm's trig can each change the last bit, and a match replayed from inputs
+// drifts apart from there.
+//
+// Range is +-32768 in steps of 1/65536. Products round down and wrap on
+// overflow; quotients round toward zero and saturate. Converting from a
+// number rounds to the nearest step.
+//
+// Converts to float implicitly, so code that only reads gameplay values (AI,
+// rendering) works unchanged. Arithmetic between two Fixed values stays fixed,
+// and so does adding or subtracting a plain number; multiplying or dividing
+// by one, or comparing with one, is done in float.
+class Fixed
+{
+public:
+    static const int FRACTION_BITS = 16;
+    static const int32_t ONE = 1 << FRACTION_BITS;
+
+    Fixed() : raw(0) {}
+
+    template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+    Fixed(T value) : raw(toRaw(static_cast<double>(value))) {}
+
+    static Fixed fromRaw(int32_t raw)
+    {
+        Fixed value;
+        value.raw = raw;
+        return value;
+    }
+
+    int32_t getRaw() const { return raw; }
+
+    operator float() const { return static_cast<float>(raw) * (1.0f / ONE); }
+
+    Fixed operator-() const { return fromRaw(-raw); }
+
+    Fixed& operator+=(Fixed other) { raw += other.raw; return *this; }
+    Fixed& operator-=(Fixed other) { raw -= other.raw; return *this; }
+    Fixed& operator*=(Fixed other) { raw = multiply(raw, other.raw); return *this; }
+    Fixed& operator/=(Fixed other) { raw = divide(raw, other.raw); return *this; }
+
+    static int32_t multiply(int32_t a, int32_t b)
+    {
+        // Arithmetic shift on every supported compiler
+        return static_cast<int32_t>((static_cast<int64_t>(a) * b) >> FRACTION_BITS);
+    }
+
+    // Saturates rather than wrapping: collision divides by tiny moves
+    static int32_t divide(int32_t a, int32_t b)
+    {
+        int64_t quotient = static_cast<int64_t>(a) * ONE / b;
+        return static_cast<int32_t>(std::min<int64_t>(std::max<int64_t>(quotient, INT32_MIN), INT32_MAX));
+    }
+
+private:
+    int32_t raw;
+
+    static int32_t toRaw(double value)
+    {
+        return static_cast<int32_t>(std::floor(value * ONE + 0.5));
+    }
+};
+
+// Both operands must be Fixed; anything else falls through to float arithmetic
+template <typename T>
+using FixedOnly = typename std::enable_if<std::is_same<T, Fixed>::value, T>::type;
+
+template <typename T>
+using FixedCompare = typename std::enable_if<std::is_same<T, Fixed>::value, bool>::type;
+
+template <typename T> FixedOnly<T> operator+(T a, T b) { return a += b; }
+template <typename T> FixedOnly<T> operator-(T a, T b) { return a -= b; }
+template <typename T> FixedOnly<T> operator*(T a, T b) { return a *= b; }
+template <typename T> FixedOnly<T> operator/(T a, T b) { return a /= b; }
+
+// Offsetting by a plain number stays fixed too, so positions built from a
+// character's position plus sizes and offsets come out the same everywhere
+template <typename T>
+using PlainNumber = typename std::enable_if<std::is_arithmetic<T>::value, Fixed>::type;
+
+template <typename T> PlainNumber<T> operator+(Fixed a, T b) { return a += Fixed(b); }
+template <typename T> PlainNumber<T> operator+(T a, Fixed b) { return b += Fixed(a); }
+template <typename T> PlainNumber<T> operator-(Fixed a, T b) { return a -= Fixed(b); }
+template <typename T> PlainNumber<T> operator-(T a, Fixed b) { return Fixed(a) -= b; }
+
+template <typename T> FixedCompare<T> operator==(T a, T b) { return a.getRaw() == b.getRaw(); }
+template <typename T> FixedCompare<T> operator!=(T a, T b) { return a.getRaw() != b.getRaw(); }
+template <typename T> FixedCompare<T> operator<(T a, T b) { return a.getRaw() < b.getRaw(); }
+template <typename T> FixedCompare<T> operator>(T a, T b) { return a.getRaw() > b.getRaw(); }
+template <typename T> FixedCompare<T> operator<=(T a, T b) { return a.getRaw() <= b.getRaw(); }
+template <typename T> FixedCompare<T> operator>=(T a, T b) { return a.getRaw() >= b.getRaw(); }
+
+inline Fixed fixedAbs(Fixed value)
+{
+    return value.getRaw() < 0 ? -value : value;
+}
+
+// Sine and cosine of an angle in degrees, looked up in a quarter-wave table
+// of 256 steps and interpolated linearly (error within 3e-5). The table is
+// built with integer arithmetic only, so it is identical everywhere too.
+Fixed fixedSin(Fixed degrees);
+Fixed fixedCos(Fixed degrees);
+
+#endif // FIXED_H
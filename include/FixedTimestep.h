@@ -0,0 +1,51 @@
+#ifndef FIXED_TIMESTEP_H
+#define FIXED_TIMESTEP_H
+
+#include "GameConfig.h"
+
+// Longest real frame the loop will try to catch up on, so one long hitch
+// does not trigger an unbounded burst of ticks
+const float MAX_FRAME_SECONDS = 0.25f;
+
+// Accumulator that converts variable render frame times into a whole number
+// of fixed-length simulation ticks.
+//
+// Gameplay runs at SIMULATION_TICK_RATE only: speeds, gravity and every
+// frame-counted timer are tuned per 60 Hz tick, and replays and snapshots
+// count those ticks.
+class FixedTimestep {
+public:
+    FixedTimestep()
+        : tickSeconds(1.0 / SIMULATION_TICK_RATE), accumulator(0.0)
+    {
+    }
+
+    // Add elapsed real time and return how many ticks are now due
+    int advance(float frameSeconds)
+    {
+        if (frameSeconds > MAX_FRAME_SECONDS) frameSeconds = MAX_FRAME_SECONDS;
+        if (frameSeconds < 0.0f) frameSeconds = 0.0f;
+
+        accumulator += frameSeconds;
+
+        int ticks = 0;
+        while (accumulator >= tickSeconds)
+        {
+            accumulator -= tickSeconds;
+            ticks++;
+        }
+        return ticks;
+    }
+
+    // Fraction of a tick elapsed since the last one ran (0 to 1)
+    float alpha() const
+    {
+        return static_cast<float>(accumulator / tickSeconds);
+    }
+
+private:
+    double tickSeconds;
+    double accumulator;
+};
+
+#endif // FIXED_TIMESTEP_H
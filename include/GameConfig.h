@@ -48,6 +48,15 @@ const int LEDGE_COOLDOWN = 60; // Frames before can grab same ledge again
 // Hitstun and knockback
 const float HITSTUN_MULTIPLIER = 0.4f; // Hitstun frames = knockback * multiplier
 
+// Simulation tick rate (frame-based timers are counted in ticks)
+const int SIMULATION_TICK_RATE = 60;
+const float SIMULATION_TICK_SECONDS = 1.0f / SIMULATION_TICK_RATE;
+
+// Most particles alive at once; the frontend lowers this toward the minimum
+// while frames run over budget
+const int PARTICLE_BUDGET = 8192;
+const int PARTICLE_BUDGET_MIN = 1024;
+
 // Game state timers
 const int RESPAWN_TIME = 120; // Frames before respawning (2 seconds)
 const int GAME_START_TIMER = 180; // 3 second countdown at start
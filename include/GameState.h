@@ -83,7 +83,7 @@ public:
     // Core methods
     void initialize();
     void update();
-    void draw();
+    void draw(); // Defined in the frontend library
 
     // State transition methods
     void changeState(State newState);
@@ -104,7 +104,7 @@ public:
     void updateItems();
     void drawItems();
 
-    // Draw methods for different states
+    // Draw methods for different states (defined in the frontend library)
     void drawTitleScreen();
     void drawCharacterSelect();
     void drawStageSelect();
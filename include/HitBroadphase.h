@@ -0,0 +1,59 @@
+#ifndef HIT_BROADPHASE_H
+#define HIT_BROADPHASE_H
+
+#include "Real.h"
+#include <vector>
+
+// A hitbox whose rect overlaps another player's hurtbox
+struct HitCandidate
+{
+    int attacker;   // Player slot owning the hitbox
+    int attack;     // Index into the attacker's attacks, or into the projectiles
+    int defender;   // Player slot owning the hurtbox
+    bool projectile;
+};
+
+// Sort-and-sweep broadphase for one tick's hit detection.
+// Every active hitbox (projectiles included) and every hurtbox goes into one
+// flat array, which is sorted on the left edge and swept once; only boxes
+// whose x ranges meet are compared. Hit detection then runs its narrow phase
+// on the candidates instead of on every attacker, defender and hitbox.
+class HitBroadphase
+{
+public:
+    void clear();
+
+    void addHitbox(int owner, int attack, Rect rect);
+    void addProjectile(int owner, int projectile, Rect rect);
+    void addHurtbox(int owner, Rect rect);
+
+    // Overlapping pairs from different players, ordered by attacker, then
+    // defender, then attacks before projectiles, then index: the order a
+    // nested loop over them would visit
+    const std::vector<HitCandidate>& findPairs();
+
+private:
+    struct Box
+    {
+        Real minX;
+        Real maxX;
+        Real minY;
+        Real maxY;
+        int owner;
+        int attack;     // -1 for hurtboxes
+        bool projectile;
+    };
+
+    std::vector<Box> boxes;
+
+    // Sweep state: boxes whose x range is still open, split by kind
+    std::vector<int> openHitboxes;
+    std::vector<int> openHurtboxes;
+
+    std::vector<HitCandidate> pairs;
+
+    void add(int owner, int attack, bool projectile, Rect rect);
+    void sweep(const Box& box, const std::vector<int>& open, bool boxIsHitbox);
+};
+
+#endif // HIT_BROADPHASE_H
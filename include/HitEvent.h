@@ -0,0 +1,44 @@
+#ifndef HIT_EVENT_H
+#define HIT_EVENT_H
+
+#include "raylib.h"
+#include "HitBroadphase.h"
+#include "attacks/AttackBox.h"
+#include <cstddef>
+#include <vector>
+
+class Character;
+class ProjectilePool;
+
+// One hitbox overlapping another player's hurtbox during a tick.
+// Detection only records these; World resolves them afterwards, in order,
+// and hands each resolved one to the effects, the stats and the AI.
+struct HitEvent
+{
+    int attacker;                   // Player slot owning the hitbox
+    int victim;                     // Player slot that was hit
+    int hitbox;                     // Index into the attacker's attacks, or into
+                                    // World::projectiles for PROJECTILE
+    AttackBox::HitboxType type;
+    Vector2 point;                  // Where the hit flash goes
+};
+
+// Midway between the centres of the two boxes
+inline Vector2 hitPoint(Rectangle hitbox, Rectangle hurtbox)
+{
+    return {
+        (hitbox.x + hitbox.width / 2 + hurtbox.x + hurtbox.width / 2) / 2,
+        (hitbox.y + hitbox.height / 2 + hurtbox.y + hurtbox.height / 2) / 2
+    };
+}
+
+// Narrow phase for candidates [begin, end): appends an event for each pair
+// that still overlaps. Only reads the players and projectiles, so separate
+// ranges can be detected on separate threads, each into its own vector;
+// concatenated in range order they come out in the order the candidates were
+// given.
+void detectHits(const std::vector<Character*>& players, const ProjectilePool& projectiles,
+                const std::vector<HitCandidate>& candidates, size_t begin, size_t end,
+                std::vector<HitEvent>& out);
+
+#endif // HIT_EVENT_H
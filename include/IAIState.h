@@ -17,7 +17,7 @@ public:
     virtual void UpdateState(Character* enemy, Character* player, int frameCount) = 0;
     virtual void AnalyzePlayerPatterns() = 0;
     virtual bool DetectPlayerHabit(
-        const std::deque<CharacterState>& history,
-        CharacterState state,
+        const std::deque<CharacterState::State>& history,
+        CharacterState::State state,
         float threshold) = 0;
 };
@@ -0,0 +1,71 @@
+#ifndef MOVING_PLATFORMS_H
+#define MOVING_PLATFORMS_H
+
+#include "raylib.h"
+#include "Platform.h"
+#include "Real.h"
+#include <cstdint>
+#include <vector>
+
+class SnapshotWriter;
+class SnapshotReader;
+class StateHasher;
+
+// Kinematic stage platforms: each travels a straight path at a steady speed,
+// pushed by nothing. The platforms themselves stay in the stage's platform
+// list, so collision, the AI and drawing treat them like any other; this only
+// moves them. Paths and progress live in flat arrays (structure of arrays)
+// and one pass a tick advances them all, so a stage can have dozens.
+//
+// update() leaves each platform's step in Platform::motion. The collision
+// sweep uses it to carry characters standing on the platform and to catch
+// characters the platform moves into (see sweepPlatforms).
+class MovingPlatforms
+{
+public:
+    // Move platforms[index] from where it is now until its top-left corner
+    // reaches end, at speed units per tick. Looping platforms then head back
+    // and go on shuttling; the others stop at end.
+    void add(int index, const std::vector<Platform>& platforms, Vector2 end, float speed, bool loop = true);
+
+    void clear();
+
+    int size() const { return static_cast<int>(platform.size()); }
+
+    // Index into the stage's platforms of entry i
+    int platformIndex(int i) const { return platform[i]; }
+
+    // Everything entry i covers anywhere along its path, for the PlatformGrid
+    Rectangle pathBounds(int i, const std::vector<Platform>& platforms) const;
+
+    // Advance every platform one tick and set its motion
+    void update(std::vector<Platform>& platforms);
+
+    // Progress along the paths; restore() also puts the platforms back there.
+    // Paths are part of the stage and are not saved.
+    void save(SnapshotWriter& writer) const;
+    bool restore(SnapshotReader& reader, std::vector<Platform>& platforms);
+
+    // Progress into a state hash (see World::stateHash)
+    void hash(StateHasher& hasher) const;
+
+private:
+    std::vector<int> platform;
+    std::vector<Real> startX;
+    std::vector<Real> startY;
+    std::vector<Real> pathX;        // End minus start
+    std::vector<Real> pathY;
+    std::vector<uint8_t> looping;
+
+    std::vector<Real> progress;     // 0 at the start, 1 at the end
+    std::vector<Real> rate;         // Progress per tick, negative on the way back, 0 once stopped
+    std::vector<Real> positionX;    // Top-left corner, start + path * progress
+    std::vector<Real> positionY;
+    std::vector<Real> motionX;      // Last update's step
+    std::vector<Real> motionY;
+
+    // Copy positions and motion into the stage's platforms
+    void apply(std::vector<Platform>& platforms) const;
+};
+
+#endif // MOVING_PLATFORMS_H
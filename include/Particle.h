@@ -15,7 +15,7 @@ struct Particle {
     Particle(Vector2 pos, Vector2 vel, float s, int life, Color col);
     
     bool update();
-    void draw();
+    void draw(); // Defined in the frontend library
 };
 
 #endif // PARTICLE_H
\ No newline at end of file
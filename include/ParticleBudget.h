@@ -0,0 +1,32 @@
+#ifndef PARTICLE_BUDGET_H
+#define PARTICLE_BUDGET_H
+
+// Adjusts a ParticlePool budget from measured frame times.
+// Frames over the target shrink the budget by a tenth (down to the minimum);
+// frames comfortably under it grow it back slowly, so one spike does not
+// make the effects flicker. Times are smoothed before they are compared.
+//
+// Only the frontend feeds this: headless runs keep a fixed budget, so their
+// particle counts do not depend on the machine they run on.
+class ParticleBudget {
+public:
+    ParticleBudget(int minBudget, int maxBudget, float targetFrameMs);
+
+    // Feed one frame's work time (excluding the vsync wait); returns the budget to apply
+    int update(float frameMs);
+
+    int get() const { return budget; }
+    float getSmoothedFrameMs() const { return smoothedMs; }
+
+    // Back to the full budget, e.g. at the start of a match
+    void reset();
+
+private:
+    int minimum;
+    int maximum;
+    int budget;
+    float targetMs;
+    float smoothedMs;
+};
+
+#endif // PARTICLE_BUDGET_H
@@ -0,0 +1,105 @@
+#ifndef PARTICLE_EMITTER_H
+#define PARTICLE_EMITTER_H
+
+#include "raylib.h"
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+class ParticlePool;
+
+// Declarative description of one particle burst.
+// Every random property is drawn uniformly from its [min, max] range.
+struct EmitterDesc {
+    int count;
+
+    float speedMin, speedMax;
+    float sizeMin, sizeMax;
+    int lifespanMin, lifespanMax;  // Ticks
+
+    // Spray cone in degrees, screen space (0 points right, 90 down).
+    // A spread of 360 sprays every way.
+    float direction;
+    float spread;
+
+    // Each particle takes one palette entry, or the base color passed to
+    // emit() when that counts as an extra entry; an empty palette without the
+    // base color uses white. Every channel is then moved by up to +-colorJitter.
+    const Color* palette;
+    int paletteSize;
+    bool useBaseColor;
+    int colorJitter;
+
+    int blend;     // raylib BlendMode
+    int priority;  // ParticlePriority, for the pool's budget
+};
+
+// Spawns bursts straight into a ParticlePool.
+// Random values come from the cosmetic stream in one batch per burst, and
+// directions from a sine table, so a 150 particle explosion costs a few
+// microseconds. Emitting is cosmetic: nothing spawns while cosmetics are off.
+namespace ParticleEmitter {
+    // Spawn desc.count particles at position; heading (degrees) rotates the
+    // spray cone. Returns how many the pool's budget let through.
+    int emit(ParticlePool& pool, const EmitterDesc& desc, Vector2 position,
+             Color baseColor = WHITE, float heading = 0.0f);
+}
+
+// A burst generated once, up front, and replayed many times.
+// Each layer is an emitter (spread is ignored: templates spray every way)
+// baked into a few variants. Spawning one picks a variant, a rotation and a
+// mirroring from a single cosmetic random value, then copies the baked
+// velocities, sizes, lifespans and colors into the pool in bulk, so the
+// cost per explosion is constant and needs no per-particle random numbers
+// or trig. Palette indices are stored instead of colors, so the base color
+// (plus its baked jitter) is applied at spawn time.
+class BurstTemplate {
+public:
+    BurstTemplate(std::initializer_list<EmitterDesc> layers, int variants, uint64_t seed);
+
+    // Returns how many particles the pool's budget let through; cosmetic, like emit()
+    int spawn(ParticlePool& pool, Vector2 position, Color baseColor = WHITE) const;
+
+    // Particles in one full instance
+    int size() const { return perVariant; }
+
+private:
+    struct ColorOffset {
+        int8_t r, g, b;
+    };
+
+    struct Layer {
+        EmitterDesc desc;
+        int offset;  // First particle of the layer within a variant
+    };
+
+    std::vector<Layer> layers;
+    int perVariant;
+    int variantCount;
+
+    // Variant-major: variant v's particles start at v * perVariant
+    std::vector<float> velX;
+    std::vector<float> velY;
+    std::vector<float> radius;
+    std::vector<int> lifespan;
+    std::vector<uint8_t> paletteIndex;  // Equal to the layer's paletteSize for the base color
+    std::vector<ColorOffset> jitter;
+};
+
+// Baked bursts, built on first use
+namespace BurstTemplates {
+    const BurstTemplate& explosion();         // Death explosion, the EXPLOSION_BURST emitter
+    const BurstTemplate& massiveExplosion();  // Fire core, smoke, sparks and debris, as createMassiveExplosionParticles
+}
+
+// Bursts used by the game
+namespace Emitters {
+    extern const EmitterDesc EXPLOSION_BURST;   // Death explosion, in the character's colors
+    extern const EmitterDesc EXPLOSION_TRAIL;   // Each tick of the first half of an explosion
+    extern const EmitterDesc SPLASH;            // Landings and hits, white to light blue
+    extern const EmitterDesc BLAST;             // Around the base color
+    extern const EmitterDesc EXPLOSION;         // Smaller blast around the base color
+    extern const EmitterDesc HIT;               // 60 degree cone; aim with emit()'s heading
+}
+
+#endif // PARTICLE_EMITTER_H
@@ -0,0 +1,46 @@
+#ifndef PARTICLE_KERNEL_H
+#define PARTICLE_KERNEL_H
+
+#include <cstdint>
+
+// Field arrays of a particle pool, as the integration kernel sees them
+struct ParticleFields {
+    float* posX;
+    float* posY;
+    float* velX;
+    float* velY;
+    float* size;
+    int* life;
+    const int* lifespan;
+};
+
+// Particle integration, vectorized by hand.
+// Every level performs the same float operations in the same order as
+// Particle::update (no fused multiply-add), so results are bit-identical
+// whichever one runs; snapshots and rollback do not depend on the CPU.
+namespace ParticleKernel {
+    enum Level {
+        SCALAR,
+        SSE2,  // 4 particles per instruction
+        AVX2   // 8 particles per instruction
+    };
+
+    // Best level this CPU supports
+    Level detectLevel();
+
+    // Level integrate() uses; starts at detectLevel()
+    Level getLevel();
+
+    // Force a level, e.g. for benchmarks; clamped to what the CPU supports.
+    // Returns the level actually selected.
+    Level setLevel(Level level);
+
+    const char* levelName(Level level);
+
+    // Advance count particles by one tick and, in the same pass, set bit i of
+    // aliveMask[i / 32] when particle i is still alive afterwards (bits past
+    // count in the last word are cleared). Returns the number that expired.
+    int integrate(const ParticleFields& fields, int count, uint32_t* aliveMask);
+}
+
+#endif // PARTICLE_KERNEL_H
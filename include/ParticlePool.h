@@ -0,0 +1,131 @@
+#ifndef PARTICLE_POOL_H
+#define PARTICLE_POOL_H
+
+#include "raylib.h"
+#include "Particle.h"
+#include <cstdint>
+#include <vector>
+
+class SnapshotWriter;
+class SnapshotReader;
+
+// How much a particle matters when the budget runs out; lower priorities
+// are culled first and may only fill part of the budget
+enum ParticlePriority {
+    PRIORITY_DEBRIS,    // Trails and filler that nobody misses
+    PRIORITY_EFFECT,    // Explosions, splashes
+    PRIORITY_GAMEPLAY,  // Readable feedback such as hit sparks
+    PRIORITY_COUNT
+};
+
+// Writable view of slots handed out by ParticlePool::claim, for bulk spawners
+struct ParticleSpan {
+    int count;
+    float* posX;
+    float* posY;
+    float* velX;
+    float* velY;
+    float* size;
+    int* life;
+    int* lifespan;
+    Color* color;
+    uint8_t* blend;
+    uint8_t* priority;
+};
+
+// Fixed-capacity particle storage shared by every emitter in a world.
+// Each field lives in its own array (structure of arrays) so the update runs
+// through ParticleKernel, several particles per instruction. Expired particles
+// are replaced by survivors from the end, so removal is O(1) and the live
+// particles always occupy [0, size()).
+//
+// A budget below the capacity caps how many particles live at once. Each
+// priority may fill the budget up to its share (debris 3/4, effects 7/8,
+// gameplay all of it); a spawn that does not fit in its share culls
+// lower-priority particles to make room, and otherwise gets clipped.
+class ParticlePool {
+public:
+    static const int DEFAULT_CAPACITY = 16384;
+
+    explicit ParticlePool(int capacity = DEFAULT_CAPACITY);
+
+    // Add a particle; when it does not fit the budget it is dropped and false returned.
+    // blend is the raylib BlendMode it is drawn with.
+    bool spawn(Vector2 position, Vector2 velocity, float size, int lifespan, Color color,
+               int blend = BLEND_ALPHA, int priority = PRIORITY_EFFECT);
+    bool spawn(const Particle& particle);
+
+    // Add a batch; returns how many fit
+    int spawn(const std::vector<Particle>& particles);
+
+    // Append up to requested slots of a priority (as many as the budget allows)
+    // and return them for the caller to fill in; every field of every claimed
+    // slot except priority must be written
+    ParticleSpan claim(int requested, int priority = PRIORITY_EFFECT);
+
+    // Most particles alive at once, clamped to [0, capacity()]. Lowering it
+    // takes effect at the next update, which culls the lowest priorities first.
+    void setBudget(int maxParticles);
+    int getBudget() const { return budget; }
+
+    // Particles dropped or culled for the budget since the last call
+    int takeCulledCount();
+
+    // Advance every particle by one tick (same motion as Particle::update) and drop the expired ones
+    void update();
+
+    void clear();
+
+    int size() const { return count; }
+    int capacity() const { return maxCount; }
+    bool empty() const { return count == 0; }
+
+    // Copy of one live particle, for code that still works with Particle values
+    Particle get(int index) const;
+
+    // Field arrays, valid for indices [0, size())
+    const float* positionX() const { return posX.data(); }
+    const float* positionY() const { return posY.data(); }
+    const float* velocityX() const { return velX.data(); }
+    const float* velocityY() const { return velY.data(); }
+    const float* sizes() const { return radius.data(); }
+    const int* lives() const { return life.data(); }
+    const int* lifespans() const { return lifespan.data(); }
+    const Color* colors() const { return color.data(); }
+    const uint8_t* blendModes() const { return blend.data(); }
+    const uint8_t* priorities() const { return priority.data(); }
+
+    // Live particles only; restoring never changes the capacity
+    void save(SnapshotWriter& writer) const;
+    bool restore(SnapshotReader& reader);
+
+private:
+    int count;
+    int maxCount;
+    int budget;
+    int culled;
+
+    std::vector<float> posX;
+    std::vector<float> posY;
+    std::vector<float> velX;
+    std::vector<float> velY;
+    std::vector<float> radius;
+    std::vector<int> life;
+    std::vector<int> lifespan;
+    std::vector<Color> color;
+    std::vector<uint8_t> blend;
+    std::vector<uint8_t> priority;
+
+    // Bit i set while particle i is alive; written by the kernel each update
+    std::vector<uint32_t> aliveMask;
+
+    void moveParticle(int from, int to);
+
+    // Most particles of a priority the budget admits
+    int shareOf(int priorityLevel) const;
+
+    // Remove particles below a priority, lowest first, until at most target remain
+    void cull(int target, int belowPriority);
+};
+
+#endif // PARTICLE_POOL_H
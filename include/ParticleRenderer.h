@@ -0,0 +1,55 @@
+#ifndef PARTICLE_RENDERER_H
+#define PARTICLE_RENDERER_H
+
+#include "raylib.h"
+#include <vector>
+
+class VfxManager;
+
+// Draws a world's effects in one batched pass. Particles and hit flashes are
+// textured quads cut from one pre-rendered texture (a soft disc and a thin
+// ring), instead of tessellating a circle per particle; shockwaves are thin
+// line circles. Everything queued in a frame is grouped by blend mode and
+// sent through rlgl, so each group costs one draw call (plus one for the
+// shockwave lines) unless it overflows the render batch.
+//
+// Defined in the frontend library; load() needs an open window.
+class ParticleRenderer {
+public:
+    // Counts for the most recent flush()
+    struct Stats {
+        int drawCalls;
+        int quads;
+    };
+
+    ParticleRenderer();
+
+    void load();
+    void unload();
+
+    // Queue every live particle, hit flash and shockwave (vfx must outlive the flush)
+    void add(const VfxManager& vfx);
+
+    // Draw everything queued since the last flush
+    void flush();
+
+    const Stats& getStats() const { return stats; }
+
+private:
+    enum Shape {
+        DISC,
+        RING
+    };
+
+    Texture2D texture;
+    std::vector<const VfxManager*> queued;
+    Stats stats;
+
+    void drawParticles(const VfxManager& vfx, int blend);
+    void drawFlashes(const VfxManager& vfx);
+    void drawShockwaves(const VfxManager& vfx);
+    void drawQuad(Vector2 center, float radius, Color color, Shape shape);
+    void drawCircleLines(Vector2 center, float radius, Color color);
+};
+
+#endif // PARTICLE_RENDERER_H
@@ -27,6 +27,6 @@ std::vector<Particle> createMassiveExplosionParticles(Vector2 position, int coun
 std::vector<Particle> createExplosionParticles(Vector2 position, int count, Color baseColor);
 std::vector<Particle> createHitParticles(Vector2 position, Vector2 direction, int count, Color color);
 bool updateParticles(std::vector<Particle>& particles);
-void drawParticles(const std::vector<Particle>& particles);
+void drawParticles(const std::vector<Particle>& particles); // Defined in the frontend library
 
 #endif // PARTICLE_SYSTEM_H
\ No newline at end of file
@@ -16,11 +16,12 @@ public:
     Rectangle rect;
     Color color;
     PlatformType type;
+    Vector2 motion;     // How far the platform moved this tick; zero unless MovingPlatforms drives it
 
     // Constructor with platform type parameter (defaults to PASSTHROUGH)
     Platform(float x, float y, float width, float height, Color col, PlatformType platformType = PASSTHROUGH);
 
-    // Draw method declaration
+    // Draw method declaration (defined in the frontend library)
     void draw();
 };
 
@@ -0,0 +1,60 @@
+#ifndef PLATFORM_GRID_H
+#define PLATFORM_GRID_H
+
+#include "raylib.h"
+#include "Platform.h"
+#include <vector>
+
+// Uniform grid over a stage's platforms, built once when the stage is.
+// Collision asks it for the platforms near a character instead of testing
+// every platform, so a stage with hundreds of platforms costs about as
+// much per character as one with four.
+//
+// Cells cover the bounding box of the platforms; areas outside it are
+// clamped to the edge cells, which only ever adds candidates.
+class PlatformGrid
+{
+public:
+    static const float DEFAULT_CELL_SIZE;
+
+    PlatformGrid();
+
+    // Index the platforms; call again whenever the stage's platforms change
+    void build(const std::vector<Platform>& platforms, float cellSize = DEFAULT_CELL_SIZE);
+
+    // Index platform i under bounds[i] rather than its rect, e.g. the whole
+    // path of a moving platform, so the grid stays valid while it moves
+    void build(const std::vector<Rectangle>& bounds, float cellSize = DEFAULT_CELL_SIZE);
+
+    void clear();
+
+    // Replace out with the indices of every platform whose rect may overlap
+    // area, in ascending order, so callers visit them in stage order
+    void query(Rectangle area, std::vector<int>& out) const;
+
+    // Platforms indexed by the last build()
+    int size() const { return platformCount; }
+
+private:
+    int platformCount;
+    float originX;
+    float originY;
+    float cellSize;
+    float inverseCellSize;
+    int columns;
+    int rows;
+
+    // Platforms of cell c are items[cellStart[c], cellStart[c + 1])
+    std::vector<int> cellStart;
+    std::vector<int> items;
+
+    // First cell each platform covers; a query reports a platform only from
+    // the first of its cells inside the queried area, so never twice
+    std::vector<int> firstColumn;
+    std::vector<int> firstRow;
+
+    int columnOf(float x) const;
+    int rowOf(float y) const;
+};
+
+#endif // PLATFORM_GRID_H
@@ -0,0 +1,45 @@
+#ifndef PLAYER_INPUT_H
+#define PLAYER_INPUT_H
+
+#include <cstdint>
+
+// Buttons a player can hold during a simulation tick
+namespace InputButton {
+    enum Button : uint16_t {
+        LEFT    = 1 << 0,
+        RIGHT   = 1 << 1,
+        UP      = 1 << 2,
+        DOWN    = 1 << 3,
+        ATTACK  = 1 << 4,   // Basic attack
+        SPECIAL = 1 << 5,   // Special attack
+        SMASH   = 1 << 6,   // Smash attack
+        SHIELD  = 1 << 7,   // Shield / dodge
+        GRAB    = 1 << 8    // Grab
+    };
+}
+
+// One player's controls for a single tick, packed as a bitmask of held buttons.
+// Press and release edges are derived by comparing against the previous tick.
+struct PlayerInput {
+    uint16_t buttons;
+
+    PlayerInput() : buttons(0) {}
+    explicit PlayerInput(uint16_t heldButtons) : buttons(heldButtons) {}
+
+    bool isDown(InputButton::Button button) const
+    {
+        return (buttons & button) != 0;
+    }
+
+    bool isPressed(InputButton::Button button, const PlayerInput& previous) const
+    {
+        return isDown(button) && !previous.isDown(button);
+    }
+
+    bool isReleased(InputButton::Button button, const PlayerInput& previous) const
+    {
+        return !isDown(button) && previous.isDown(button);
+    }
+};
+
+#endif // PLAYER_INPUT_H
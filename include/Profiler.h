@@ -0,0 +1,96 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <cstdint>
+#include <vector>
+
+// Scoped timers are compiled in for debug builds and out of release builds
+// (NDEBUG) unless VIBESTER_PROFILE is set explicitly.
+#ifndef VIBESTER_PROFILE
+#ifdef NDEBUG
+#define VIBESTER_PROFILE 0
+#else
+#define VIBESTER_PROFILE 1
+#endif
+#endif
+
+// Frames kept for the rolling averages and the frame-time graph
+const int PROFILE_HISTORY_FRAMES = 120;
+
+// Hierarchical frame profiler, one per thread.
+// Zones are identified by their name and the zone they were opened in, so the
+// same name under different parents is tracked separately.
+class Profiler {
+public:
+    struct Zone {
+        const char* name;   // Must outlive the profiler (string literals)
+        int parent;         // Index into zones, -1 at the top level
+        int depth;
+        uint64_t ticks;     // Accumulated during the current frame
+        int calls;          // Openings during the current frame
+        int lastCalls;      // Openings during the last finished frame
+        float history[PROFILE_HISTORY_FRAMES]; // Milliseconds per frame
+        float averageMs;
+        float maxMs;
+    };
+
+    // Profiler for the calling thread
+    static Profiler& get();
+
+    // Open and close a zone; use PROFILE_SCOPE instead of calling these directly
+    void begin(const char* name);
+    void end();
+
+    // Close out the frame: fold zone times into the history and record the frame time
+    void endFrame();
+
+    const std::vector<Zone>& getZones() const { return zones; }
+    float getFrameMs(int framesAgo) const;
+    float getAverageFrameMs() const;
+    float getMaxFrameMs() const;
+
+    // Breakdown tree and frame-time graph at (x, y)
+    void drawOverlay(int x, int y) const; // Defined in the frontend library
+
+    // Raw timestamp in profiler ticks (TSC on x86, steady_clock elsewhere)
+    static uint64_t now();
+
+private:
+    Profiler();
+
+    struct OpenZone {
+        int zone;
+        uint64_t start;
+    };
+
+    std::vector<Zone> zones;
+    std::vector<OpenZone> stack;
+
+    float frameHistory[PROFILE_HISTORY_FRAMES];
+    int historyIndex;
+    uint64_t frameStartTicks;
+    int64_t frameStartNanos;
+    double nanosPerTick;
+
+    int findOrAddZone(const char* name, int parent);
+};
+
+// Times the enclosing block as a child of whatever zone is open
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name) { Profiler::get().begin(name); }
+    ~ProfileScope() { Profiler::get().end(); }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+};
+
+#if VIBESTER_PROFILE
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(name)
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#endif
+
+#endif // PROFILER_H
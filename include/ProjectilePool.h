@@ -0,0 +1,116 @@
+#ifndef PROJECTILE_POOL_H
+#define PROJECTILE_POOL_H
+
+#include "raylib.h"
+#include "attacks/AttackBox.h"
+#include <cstdint>
+#include <vector>
+
+class SnapshotWriter;
+class SnapshotReader;
+class StateHasher;
+
+// What a projectile does to whoever it hits (see AttackBox)
+struct ProjectileHit {
+    Real damage;
+    Real baseKnockback;
+    Real knockbackScaling;
+    Real knockbackAngle;
+    int hitLag;
+    int shieldStun;
+};
+
+// Every projectile in flight in a world, in fixed-capacity arrays.
+// Projectiles belong to the world rather than to the character that fired
+// them, so they keep flying when their owner starts another attack, and one
+// pass moves, ages and culls all of them. Position, velocity and lifetime
+// each live in their own array (structure of arrays) so that pass vectorizes;
+// hit properties are only read when a projectile connects.
+//
+// Removal keeps the survivors in order, and indices stay valid until the
+// next update() or removeSpent().
+class ProjectilePool {
+public:
+    static const int DEFAULT_CAPACITY = 1024;
+
+    explicit ProjectilePool(int capacity = DEFAULT_CAPACITY);
+
+    // Add a projectile covering rect that moves by velocity each tick for
+    // lifetime ticks. owner is the firing player's slot. Returns false when
+    // the pool is full.
+    bool spawn(int owner, Rect rect, Vec2 velocity, int lifetime, const ProjectileHit& hit,
+               bool destroyOnHit = true);
+
+    // Move every projectile one tick, then drop the expired ones and those
+    // past the blast zones
+    void update();
+
+    // Mark a projectile as used up; it stops hitting at once and is removed
+    // by the next update() or removeSpent()
+    void expire(int index) { life[index] = 0; }
+    bool isSpent(int index) const { return life[index] <= 0; }
+    void removeSpent();
+
+    void clear();
+
+    int size() const { return count; }
+    int capacity() const { return maxCount; }
+
+    // Field arrays, valid for indices [0, size())
+    const Real* positionX() const { return posX.data(); }
+    const Real* positionY() const { return posY.data(); }
+    const Real* velocityX() const { return velX.data(); }
+    const Real* velocityY() const { return velY.data(); }
+    const int* lives() const { return life.data(); }
+    const int* owners() const { return owner.data(); }
+
+    Rect rect(int index) const { return {posX[index], posY[index], width[index], height[index]}; }
+
+    // The projectile as a hitbox, for Character::applyHit
+    AttackBox attackBox(int index) const;
+
+    // Draw every projectile, blended between the last two ticks (defined in the frontend library)
+    void draw(float alpha) const;
+
+    // Live projectiles only; restoring never changes the capacity
+    void save(SnapshotWriter& writer) const;
+    bool restore(SnapshotReader& reader);
+
+    // Live projectiles into a state hash (see World::stateHash)
+    void hash(StateHasher& hasher) const;
+
+private:
+    int count;
+    int maxCount;
+
+    std::vector<Real> posX;
+    std::vector<Real> posY;
+    std::vector<Real> width;
+    std::vector<Real> height;
+    std::vector<Real> velX;
+    std::vector<Real> velY;
+    std::vector<int> life;
+    std::vector<int> owner;
+    std::vector<ProjectileHit> hit;
+    std::vector<uint8_t> destroyOnHit;
+};
+
+// Makes a world's projectiles the target for characters on the calling
+// thread while the scope is alive. Scopes nest; outside any scope projectiles
+// go to a small per-thread default pool that nothing updates.
+class ProjectileScope {
+public:
+    explicit ProjectileScope(ProjectilePool& projectiles);
+    ~ProjectileScope();
+
+    ProjectileScope(const ProjectileScope&) = delete;
+    ProjectileScope& operator=(const ProjectileScope&) = delete;
+
+private:
+    ProjectilePool* previous;
+};
+
+// Projectiles that characters on the calling thread fire into
+ProjectilePool& currentProjectiles();
+
+#endif // PROJECTILE_POOL_H
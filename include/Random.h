@@ -0,0 +1,64 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cstdint>
+
+// Small, fast xoshiro128** generator.
+// Plain value type so its state can be copied into snapshots and replays.
+class Random {
+public:
+    uint32_t state[4];
+
+    explicit Random(uint64_t seedValue = 0);
+
+    // Reset the state from a 64-bit seed (expanded with splitmix64)
+    void seed(uint64_t seedValue);
+
+    // Next raw 32-bit value
+    uint32_t next();
+
+    // Integer in [min, max], inclusive on both ends like raylib's GetRandomValue
+    int range(int min, int max);
+
+    // Float in [0, 1)
+    float unit();
+
+    // Next count raw values, same sequence as calling next() count times.
+    // Keeps the state in registers for the whole batch.
+    void fill(uint32_t* out, int count);
+};
+
+// Independent streams for one match.
+// Gameplay randomness (AI decisions, items) never shares a stream with
+// cosmetic randomness (particles), so effects cannot change match outcomes.
+struct RandomStreams {
+    Random gameplay;
+    Random cosmetic;
+
+    explicit RandomStreams(uint64_t matchSeed = 0);
+
+    void seed(uint64_t matchSeed);
+};
+
+// Binds a match's streams to the calling thread for the lifetime of the scope.
+// Scopes nest; code running outside any scope uses per-thread default streams.
+class RandomScope {
+public:
+    explicit RandomScope(RandomStreams& streams);
+    ~RandomScope();
+
+    RandomScope(const RandomScope&) = delete;
+    RandomScope& operator=(const RandomScope&) = delete;
+
+private:
+    RandomStreams* previous;
+};
+
+// Draw from the streams bound to the calling thread
+int gameplayRandom(int min, int max);
+int cosmeticRandom(int min, int max);
+
+// Cosmetic stream bound to the calling thread, for batched draws
+Random& cosmeticStream();
+
+#endif // RANDOM_H
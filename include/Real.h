@@ -0,0 +1,79 @@
+#ifndef REAL_H
+#define REAL_H
+
+#include "raylib.h"
+#include "Fixed.h"
+#include <cmath>
+#include <cstdint>
+
+// Number type for gameplay physics: positions, velocities, gravity,
+// friction, knockback, damage, shield health, hitboxes, hurtboxes,
+// projectiles and platform collision.
+//
+// float by default. Building with VIBESTER_FIXED_POINT (the CMake option of
+// the same name) switches it to Q16.16 Fixed, so a match replayed from the
+// same inputs comes out bit for bit the same whatever compiler, flags or CPU
+// each build used. Rendering, particles and the AI's own reasoning stay in
+// float either way; they read physics values through Fixed's float conversion.
+#ifdef VIBESTER_FIXED_POINT
+
+using Real = Fixed;
+
+// Vector2 made of Reals; converts to and from raylib's Vector2
+struct Vec2
+{
+    Real x;
+    Real y;
+
+    Vec2() {}
+    Vec2(Real xValue, Real yValue) : x(xValue), y(yValue) {}
+    Vec2(Vector2 value) : x(value.x), y(value.y) {}
+
+    operator Vector2() const { return {x, y}; }
+};
+
+// Rectangle made of Reals, for hitboxes and hurtboxes; converts to and from
+// raylib's Rectangle
+struct Rect
+{
+    Real x;
+    Real y;
+    Real width;
+    Real height;
+
+    Rect() {}
+    Rect(Real xValue, Real yValue, Real widthValue, Real heightValue)
+        : x(xValue), y(yValue), width(widthValue), height(heightValue) {}
+    Rect(Rectangle value) : x(value.x), y(value.y), width(value.width), height(value.height) {}
+
+    operator Rectangle() const { return {x, y, width, height}; }
+};
+
+inline Real realAbs(Real value) { return fixedAbs(value); }
+inline Real degreeSin(Real degrees) { return fixedSin(degrees); }
+inline Real degreeCos(Real degrees) { return fixedCos(degrees); }
+
+// Set in the version byte of snapshots and netplay packets, so float and
+// fixed builds never load each other's state or play each other online.
+// Replays hold only inputs and play back on either.
+const uint8_t REAL_FORMAT_FLAG = 0x80;
+
+#else
+
+using Real = float;
+using Vec2 = Vector2;
+using Rect = Rectangle;
+
+inline Real realAbs(Real value) { return std::fabs(value); }
+inline Real degreeSin(Real degrees) { return sinf(degrees * DEG2RAD); }
+inline Real degreeCos(Real degrees) { return cosf(degrees * DEG2RAD); }
+
+const uint8_t REAL_FORMAT_FLAG = 0;
+
+#endif
+
+// Half of a Real, staying Real: dividing a Fixed by a plain number would go
+// through float
+inline Real realHalf(Real value) { return value * Real(0.5f); }
+
+#endif // REAL_H
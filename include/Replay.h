@@ -0,0 +1,88 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "PlayerInput.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Stages a replay can rebuild
+const uint8_t REPLAY_STAGE_DEFAULT = 0;
+
+// Everything needed to rebuild a match before its first input is applied
+struct ReplayHeader {
+    uint64_t seed;
+    uint8_t stageId;
+    uint8_t playerCount;
+    uint8_t stockCount;
+    bool aiEnabled;
+    float aiDifficulty;
+    uint32_t frameCount;
+
+    ReplayHeader()
+        : seed(0), stageId(REPLAY_STAGE_DEFAULT), playerCount(0), stockCount(0),
+          aiEnabled(false), aiDifficulty(0.0f), frameCount(0)
+    {
+    }
+};
+
+// A button mask held for a number of consecutive frames
+struct ReplayRun {
+    uint16_t buttons;
+    uint32_t length;
+};
+
+// Records per-frame inputs as run-length encoded button masks.
+//
+// File layout (little endian):
+//   "VBRP", version byte
+//   seed u64, stage u8, players u8, stocks u8, ai u8, difficulty f32
+//   frame count (varint)
+//   per player: run count (varint), then runs of (buttons varint, length varint)
+class ReplayRecorder
+{
+public:
+    explicit ReplayRecorder(const ReplayHeader& header);
+
+    // Append one frame; inputs[i] belongs to player i
+    void record(const std::vector<PlayerInput>& inputs);
+
+    const ReplayHeader& getHeader() const { return header; }
+
+    std::vector<uint8_t> encode() const;
+    bool save(const std::string& path) const;
+
+private:
+    ReplayHeader header;
+    std::vector<std::vector<ReplayRun>> runs;
+};
+
+// Decodes a replay and hands back its inputs one frame at a time
+class ReplayPlayer
+{
+public:
+    ReplayPlayer();
+
+    // Both return false (and leave the player empty) on a malformed replay
+    bool load(const std::string& path);
+    bool decode(const std::vector<uint8_t>& data);
+
+    const ReplayHeader& getHeader() const { return header; }
+    uint32_t getFrame() const { return frame; }
+    bool isFinished() const { return frame >= header.frameCount; }
+
+    // Inputs for the next frame; all buttons released once the replay ends
+    std::vector<PlayerInput> next();
+
+    // Back to the first frame
+    void rewind();
+
+private:
+    ReplayHeader header;
+    std::vector<std::vector<ReplayRun>> runs;
+    std::vector<size_t> runIndex;
+    std::vector<uint32_t> runOffset;
+    uint32_t frame;
+};
+
+#endif // REPLAY_H
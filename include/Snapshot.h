@@ -0,0 +1,168 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+class World;
+
+// Appends plain values to a flat byte buffer.
+// Only trivially copyable types are accepted, so nothing pointer-bearing can
+// slip into a snapshot by accident.
+class SnapshotWriter
+{
+public:
+    explicit SnapshotWriter(std::vector<uint8_t>& buffer) : out(buffer) {}
+
+    template <typename T>
+    void write(const T& value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "snapshot values must be trivially copyable");
+        size_t offset = out.size();
+        out.resize(offset + sizeof(T));
+        std::memcpy(out.data() + offset, &value, sizeof(T));
+    }
+
+    // Element count followed by the raw elements
+    template <typename T>
+    void writeArray(const std::vector<T>& values)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "snapshot values must be trivially copyable");
+        write(static_cast<uint32_t>(values.size()));
+        size_t offset = out.size();
+        size_t bytes = values.size() * sizeof(T);
+        out.resize(offset + bytes);
+        if (bytes > 0)
+        {
+            std::memcpy(out.data() + offset, values.data(), bytes);
+        }
+    }
+
+    // Raw elements without a count, for arrays whose length is stored elsewhere
+    template <typename T>
+    void writeSpan(const T* values, size_t count)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "snapshot values must be trivially copyable");
+        size_t offset = out.size();
+        size_t bytes = count * sizeof(T);
+        out.resize(offset + bytes);
+        if (bytes > 0)
+        {
+            std::memcpy(out.data() + offset, values, bytes);
+        }
+    }
+
+private:
+    std::vector<uint8_t>& out;
+};
+
+// Reads values back in the order they were written.
+// Reading past the end sets the failed flag and yields zeroed values.
+class SnapshotReader
+{
+public:
+    SnapshotReader(const uint8_t* bytes, size_t length) : data(bytes), size(length), pos(0), failed(false) {}
+
+    template <typename T>
+    bool read(T& value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "snapshot values must be trivially copyable");
+        if (failed || size - pos < sizeof(T))
+        {
+            failed = true;
+            std::memset(static_cast<void*>(&value), 0, sizeof(T));
+            return false;
+        }
+        std::memcpy(&value, data + pos, sizeof(T));
+        pos += sizeof(T);
+        return true;
+    }
+
+    // Counterpart of writeArray. Existing elements are overwritten in place so
+    // restoring into a vector of similar size does not reallocate.
+    template <typename T>
+    bool readArray(std::vector<T>& values)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "snapshot values must be trivially copyable");
+        uint32_t count;
+        if (!read(count) || (size - pos) / sizeof(T) < count)
+        {
+            failed = true;
+            return false;
+        }
+
+        if (values.size() > count)
+        {
+            values.erase(values.begin() + count, values.end());
+        }
+
+        size_t reuse = values.size();
+        if (reuse > 0)
+        {
+            std::memcpy(values.data(), data + pos, reuse * sizeof(T));
+        }
+
+        values.reserve(count);
+        for (size_t i = reuse; i < count; i++)
+        {
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type slot;
+            std::memcpy(&slot, data + pos + i * sizeof(T), sizeof(T));
+            values.push_back(*reinterpret_cast<T*>(&slot));
+        }
+
+        pos += count * sizeof(T);
+        return true;
+    }
+
+    // Counterpart of writeSpan, into storage the caller has already sized
+    template <typename T>
+    bool readSpan(T* values, size_t count)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "snapshot values must be trivially copyable");
+        if (failed || (size - pos) / sizeof(T) < count)
+        {
+            failed = true;
+            return false;
+        }
+        if (count > 0)
+        {
+            std::memcpy(static_cast<void*>(values), data + pos, count * sizeof(T));
+        }
+        pos += count * sizeof(T);
+        return true;
+    }
+
+    bool hasFailed() const { return failed; }
+    bool isAtEnd() const { return pos == size; }
+
+private:
+    const uint8_t* data;
+    size_t size;
+    size_t pos;
+    bool failed;
+};
+
+// Save states for the whole simulation.
+// The buffer is flat and pointer-free (characters are referenced by index), so it
+// can be kept in memory for rewind/rollback or written to disk for training runs.
+namespace Snapshot {
+    // Effects are cosmetic, so rollback saves the simulation only and
+    // restoring it leaves the effects on screen alone.
+    enum Contents {
+        WITH_EFFECTS,
+        SIMULATION_ONLY
+    };
+
+    // Serialize the world into buffer, replacing its contents (capacity is reused)
+    void save(const World& world, std::vector<uint8_t>& buffer, Contents contents = WITH_EFFECTS);
+
+    // Restore a snapshot into a world built with the same stage and player count.
+    // A SIMULATION_ONLY snapshot leaves world.vfx untouched.
+    // Returns false if the buffer is not a snapshot of a compatible world; the
+    // header and length are checked before anything is modified.
+    bool restore(World& world, const std::vector<uint8_t>& buffer);
+}
+
+#endif // SNAPSHOT_H
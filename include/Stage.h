@@ -11,7 +11,6 @@
 class StageHazard {
 public:
     enum HazardType {
-        MOVING_PLATFORM,
         DAMAGING_AREA,
         WIND_AREA,
         WATER_AREA,
@@ -36,21 +35,6 @@ public:
 };
 
 // Specific hazard types
-class MovingPlatform : public StageHazard {
-public:
-    Platform platform;
-    Vector2 startPos;
-    Vector2 endPos;
-    float speed;
-    bool isLooping;
-    bool isReversing;
-
-    MovingPlatform(Platform p, Vector2 start, Vector2 end, float spd, int timer);
-
-    void update(std::vector<Character*>& characters) override;
-    void draw() override;
-};
-
 class DamagingArea : public StageHazard {
 public:
     float damage;
@@ -124,10 +108,8 @@ public:
     void transform(int newTransform);
     void resetTransform();
 
-    // Platform methods
+    // Platform methods (moving platforms are added with World::addMovingPlatform)
     void addPlatform(float x, float y, float width, float height, Color color);
-    void addMovingPlatform(float x, float y, float width, float height,
-                          Vector2 endPos, float speed, Color color);
 
     // Hazard methods
     void addHazard(StageHazard* hazard);
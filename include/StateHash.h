@@ -0,0 +1,79 @@
+#ifndef STATE_HASH_H
+#define STATE_HASH_H
+
+#include "Real.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// 64-bit FNV-1a over gameplay values, fed one field at a time.
+// Whole structs are never hashed as bytes: padding holds whatever was on the
+// stack, so two identical states could hash differently. Floats hash their
+// bit patterns and Fixed its raw value, so the hash only matches between
+// builds that computed exactly the same numbers.
+class StateHasher
+{
+public:
+    StateHasher() : value(OFFSET_BASIS) {}
+
+    template <typename T>
+    void add(T field)
+    {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                      "hash fields one at a time, not whole structs");
+        unsigned char bytes[sizeof(T)];
+        std::memcpy(bytes, &field, sizeof(T));
+        addBytes(bytes, sizeof(T));
+    }
+
+    void add(Fixed field) { add(field.getRaw()); }
+
+    void add(Vector2 field)
+    {
+        add(field.x);
+        add(field.y);
+    }
+
+#ifdef VIBESTER_FIXED_POINT
+    void add(Vec2 field)
+    {
+        add(field.x);
+        add(field.y);
+    }
+
+    void add(Rect field)
+    {
+        add(field.x);
+        add(field.y);
+        add(field.width);
+        add(field.height);
+    }
+#endif
+
+    void add(Rectangle field)
+    {
+        add(field.x);
+        add(field.y);
+        add(field.width);
+        add(field.height);
+    }
+
+    uint64_t get() const { return value; }
+
+private:
+    static const uint64_t OFFSET_BASIS = 14695981039346656037ULL;
+    static const uint64_t PRIME = 1099511628211ULL;
+
+    uint64_t value;
+
+    void addBytes(const unsigned char* bytes, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            value = (value ^ bytes[i]) * PRIME;
+        }
+    }
+};
+
+#endif // STATE_HASH_H
@@ -0,0 +1,39 @@
+#ifndef STRESS_SCENE_H
+#define STRESS_SCENE_H
+
+#include <cstdint>
+
+class World;
+
+// Shape of a procedurally built stress scene
+struct StressConfig {
+    int characters;          // All AI-driven
+    int platforms;           // Including the solid floor
+    float solidFraction;     // Share of the extra platforms that are SOLID
+    float movingFraction;    // Share of the extra PASSTHROUGH platforms that move
+    int projectileInterval;  // Ticks between forced neutral specials per character, 0 to disable
+    int explosionInterval;   // Ticks between forced explosions, 0 to disable
+    float aiDifficulty;
+    uint64_t seed;
+
+    StressConfig()
+        : characters(16), platforms(200), solidFraction(0.25f), movingFraction(0.1f), projectileInterval(10),
+          explosionInterval(90), aiDifficulty(0.8f), seed(1)
+    {
+    }
+};
+
+// Scaling scenes for profiling: many AI characters, hundreds of platforms of
+// both types (some of them moving), constant projectile spam and a steady
+// stream of explosions.
+// The same config and seed always build and drive the same scene.
+namespace StressScene {
+    // Replace the world's stage and characters with a generated scene
+    void build(World& world, const StressConfig& config);
+
+    // Force this tick's projectiles and explosions; call before World::step.
+    // Also keeps everyone's stocks topped up so the scene never ends.
+    void drive(World& world, const StressConfig& config);
+}
+
+#endif // STRESS_SCENE_H
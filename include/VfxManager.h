@@ -0,0 +1,91 @@
+#ifndef VFX_MANAGER_H
+#define VFX_MANAGER_H
+
+#include "raylib.h"
+#include "ParticlePool.h"
+#include <vector>
+
+class SnapshotWriter;
+class SnapshotReader;
+
+// Every visual effect in a world: particles, hit flashes and explosion
+// shockwaves, in fixed-capacity arrays owned in one place. Characters hand
+// effects off here instead of keeping their own, so a tick updates all of
+// them in one pass and the frontend draws them in one batch.
+//
+// Effects are cosmetic: nothing is added while cosmetics are off.
+class VfxManager {
+public:
+    static const int MAX_FLASHES = 256;
+    static const int MAX_SHOCKWAVES = 64;
+
+    // Hit flash: a disc and ring that shrink and fade out
+    static const int FLASH_DURATION = 10;
+    static const float FLASH_SIZE;
+
+    // Shockwave: two rings that grow by SHOCKWAVE_SPEED a tick and fade out
+    static const float SHOCKWAVE_SPEED;
+
+    ParticlePool particles;
+
+    explicit VfxManager(int particleCapacity = ParticlePool::DEFAULT_CAPACITY);
+
+    // Both return false when cosmetics are off or the storage is full
+    bool addHitFlash(Vector2 position, Color color);
+    bool addShockwave(Vector2 position, int duration);
+
+    // Advance every effect by one tick and drop the finished ones
+    void update();
+
+    void clear();
+
+    // Flash and shockwave fields, valid for indices [0, flashCount()) and [0, shockwaveCount())
+    int flashCount() const { return flashes; }
+    const float* flashX() const { return flashPosX.data(); }
+    const float* flashY() const { return flashPosY.data(); }
+    const Color* flashColors() const { return flashColor.data(); }
+    const int* flashFrames() const { return flashFrame.data(); }
+
+    int shockwaveCount() const { return shockwaves; }
+    const float* shockwaveX() const { return shockwavePosX.data(); }
+    const float* shockwaveY() const { return shockwavePosY.data(); }
+    const int* shockwaveFrames() const { return shockwaveFrame.data(); }
+    const int* shockwaveDurations() const { return shockwaveDuration.data(); }
+
+    // Live effects only
+    void save(SnapshotWriter& writer) const;
+    bool restore(SnapshotReader& reader);
+
+private:
+    int flashes;
+    std::vector<float> flashPosX;
+    std::vector<float> flashPosY;
+    std::vector<Color> flashColor;
+    std::vector<int> flashFrame;
+
+    int shockwaves;
+    std::vector<float> shockwavePosX;
+    std::vector<float> shockwavePosY;
+    std::vector<int> shockwaveFrame;
+    std::vector<int> shockwaveDuration;
+};
+
+// Makes a world's effects the target for characters on the calling thread
+// while the scope is alive. Scopes nest; outside any scope effects go to a
+// per-thread default manager.
+class VfxScope {
+public:
+    explicit VfxScope(VfxManager& vfx);
+    ~VfxScope();
+
+    VfxScope(const VfxScope&) = delete;
+    VfxScope& operator=(const VfxScope&) = delete;
+
+private:
+    VfxManager* previous;
+};
+
+// Effects that characters on the calling thread hand off to
+VfxManager& currentVfx();
+
+#endif // VFX_MANAGER_H
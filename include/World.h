@@ -0,0 +1,155 @@
+#ifndef WORLD_H
+#define WORLD_H
+
+#include "raylib.h"
+#include "character/Character.h"
+#include "Platform.h"
+#include "PlatformGrid.h"
+#include "Collision.h"
+#include "HitBroadphase.h"
+#include "HitEvent.h"
+#include "MovingPlatforms.h"
+#include "ProjectilePool.h"
+#include "VfxManager.h"
+#include "PlayerInput.h"
+#include "Random.h"
+#include "Replay.h"
+#include "Snapshot.h"
+#include <vector>
+#include <memory>
+
+class EnhancedAIController;
+struct AIConfig;
+
+// Running per-player totals for one match
+struct PlayerStats {
+    int falls;            // Stocks lost
+    int KOs;              // Stocks taken from other players
+    int selfDestructs;    // Stocks lost without being hit first
+    Real damageDealt;
+    Real damageTaken;
+    int lastHitBy;        // Slot that last damaged this player during the current stock, -1 for none
+
+    PlayerStats()
+        : falls(0), KOs(0), selfDestructs(0), damageDealt(0.0f), damageTaken(0.0f), lastHitBy(-1)
+    {
+    }
+};
+
+// Headless match simulation.
+// Owns the characters, stage and effects and advances them one tick at a time
+// without needing a window, so matches can run as fast as the CPU allows.
+class World {
+public:
+    // The enhanced AI always drives this player slot
+    static const int AI_PLAYER_INDEX = 1;
+
+    std::vector<Character*> players;   // Owned, deleted in clear()
+    std::vector<Platform> platforms;
+    PlatformGrid platformGrid;         // Index over platforms, see rebuildPlatformGrid()
+    MovingPlatforms movingPlatforms;   // Which platforms move and where along their paths they are
+    std::vector<Vector2> spawnPoints;
+    ProjectilePool projectiles;        // Every player's projectiles in flight
+    VfxManager vfx;                    // Particles, hit flashes and shockwaves for the whole match
+
+    // Optional AI per player slot; slots without one take inputs
+    std::vector<std::unique_ptr<EnhancedAIController>> ai;
+
+    // Indexed like players
+    std::vector<PlayerStats> stats;
+
+    // Hits that landed during the last step, in the order they were applied
+    std::vector<HitEvent> hits;
+
+    // Per-match random streams, bound to the thread while stepping
+    RandomStreams random;
+    uint64_t seed;
+
+    // Ticks simulated since the stage was built
+    int frame;
+
+    World();
+    ~World();
+
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+
+    // Build the default battlefield stage with a player and an enemy
+    void initDefaultStage();
+
+    // Take ownership of a character as the next player slot
+    void addPlayer(Character* player);
+
+    // Rebuild the stage, seed, stocks and AI described by a replay header.
+    // Returns false if the header names a stage this build does not know.
+    bool initFromReplay(const ReplayHeader& header);
+
+    // Add a platform that shuttles between where it starts and end (its
+    // top-left corner) at speed units per tick, or stops at end without looping
+    void addMovingPlatform(const Platform& platform, Vector2 end, float speed, bool looping = true);
+
+    // Re-index platforms after adding or moving any; step() also rebuilds
+    // the grid by itself when the platform count no longer matches. Moving
+    // platforms are indexed over their whole path, so their motion never
+    // needs a rebuild.
+    void rebuildPlatformGrid();
+
+    // Reseed the gameplay and cosmetic streams; same seed and inputs replay the same match
+    void setSeed(uint64_t matchSeed);
+
+    // Attach the enhanced AI to the enemy slot
+    void enableAI(float difficulty);
+
+    // Attach the enhanced AI to any slot, playing against opponentSlot
+    void enableAI(int slot, int opponentSlot, const AIConfig& config);
+
+    // Hand every slot back to inputs
+    void disableAI();
+
+    // AI driving a slot, or null if it takes inputs
+    EnhancedAIController* getAI(int slot) const;
+
+    // Advance the simulation by one tick.
+    // inputs[i] drives players[i]; missing entries count as no buttons held.
+    void step(const std::vector<PlayerInput>& inputs);
+
+    // True once at most one player has stocks left
+    bool isMatchOver() const;
+
+    // Hash of everything that decides how the match plays out from here
+    // (see StateHash.h). Two builds fed the same inputs stay in sync exactly
+    // as long as their hashes agree frame for frame. Effects and the AI's own
+    // bookkeeping are left out; the AI acts through the characters, which are in.
+    uint64_t stateHash() const;
+
+    // Delete all characters and reset the stage
+    void clear();
+
+private:
+    friend void Snapshot::save(const World& world, std::vector<uint8_t>& buffer, Snapshot::Contents contents);
+    friend bool Snapshot::restore(World& world, const std::vector<uint8_t>& buffer);
+
+    std::vector<PlayerInput> previousInputs;
+
+    // Scratch for updatePlayers(): the tick's collision pass and the
+    // characters in it, slot for slot
+    CollisionBatch collisions;
+    std::vector<Character*> sweeping;
+
+    // Scratch for checkHits(), which leaves its events in hits
+    HitBroadphase broadphase;
+
+    // Phases of step()
+    void updatePlatforms();
+    void updatePlayers();
+    void updateProjectiles();
+    void checkHits();
+    void resolveHits();
+    void updateEffects();
+    void applyInputs(const std::vector<PlayerInput>& inputs);
+    void updateStats(const std::vector<int>& stocksBefore);
+
+    void applyInput(Character* player, const PlayerInput& input, const PlayerInput& previous);
+};
+
+#endif // WORLD_H
@@ -2,6 +2,7 @@
 #define ATTACK_BOX_H
 
 #include "raylib.h"
+#include "../Real.h"
 
 // Hitbox for character attacks
 class AttackBox {
@@ -12,11 +13,12 @@ public:
         PROJECTILE
     };
     
-    Rectangle rect;
-    float damage;
-    float baseKnockback;
-    float knockbackScaling;
-    float knockbackAngle;
+    // Placement and hit properties are Reals (see Real.h)
+    Rect rect;
+    Real damage;
+    Real baseKnockback;
+    Real knockbackScaling;
+    Real knockbackAngle;
     int hitLag;
     int shieldStun;
     HitboxType type;
@@ -25,35 +27,35 @@ public:
     int currentFrame;      // Current frame counter
     
     // For projectiles
-    Vector2 velocity;      // Movement speed and direction
+    Vec2 velocity;         // Movement speed and direction
     bool destroyOnHit;     // Whether projectile is destroyed on hit
     
     // Standard constructor
     AttackBox(
-        Rectangle r, 
-        float dmg, 
-        float baseKb, 
-        float kbScaling, 
-        float kbAngle, 
+        Rect r, 
+        Real dmg, 
+        Real baseKb, 
+        Real kbScaling, 
+        Real kbAngle, 
         int lag, 
         int shield
     );
     
     // Constructor for projectiles
     AttackBox(
-        Rectangle r, 
-        float dmg, 
-        float baseKb, 
-        float kbScaling, 
-        float kbAngle, 
+        Rect r, 
+        Real dmg, 
+        Real baseKb, 
+        Real kbScaling, 
+        Real kbAngle, 
         int lag, 
         int dur,
-        Vector2 vel, 
+        Vec2 vel, 
         bool destroy = true
     );
     
     bool update();  // Returns false if attack is expired
-    void draw(bool debug = false);
+    void draw(bool debug = false); // Defined in the frontend library
 };
 
 #endif // ATTACK_BOX_H
\ No newline at end of file
@@ -3,11 +3,12 @@
 
 #include "raylib.h"
 #include "../Platform.h"
+#include "../PlatformGrid.h"
+#include "../Collision.h"
 #include "../attacks/AttackBox.h"
 #include "CharacterPhysics.h"
 #include "CharacterStateManager.h"
 #include "CharacterState.h"
-#include "HitEffect.h"
 #include "../Particle.h"
 #include <string>
 #include <vector>
@@ -31,7 +32,7 @@ public:
     CharacterStateManager stateManager;
 
     // Smash-style properties
-    float damagePercent; // Damage as percentage (0-999%)
+    Real damagePercent; // Damage as percentage (0-999%)
     int stocks; // Lives remaining
 
     // Visual elements
@@ -48,12 +49,11 @@ public:
     // Grab reference
     Character* grabbedCharacter;
 
-    // Visual effects
-    std::vector<HitEffect> hitEffects;
+    // Hitboxes of the current attack; projectiles belong to the world (see ProjectilePool)
     std::vector<AttackBox> attacks;
 
-    // Explosion state
-    std::vector<Particle> explosionParticles;
+    // Index in World::players, -1 until added; projectiles are tagged with it
+    int slot;
 
     // Constructor
     Character(float x, float y, float w, float h, float spd, Color col, std::string n);
@@ -70,11 +70,20 @@ public:
     void drawExplosionAnimation();
 
     // Basic methods
-    Rectangle getRect();
-    Rectangle getHurtbox();
-    void update(std::vector<Platform>& platforms);
+    Rect getRect() const;
+    Rect getHurtbox() const;
+    // grid must index platforms (see PlatformGrid::build)
+    void update(std::vector<Platform>& platforms, const PlatformGrid& grid);
+
+    // update() split around its platform sweep, so World can sweep every
+    // character in one CollisionBatch. beginUpdate applies this tick's physics
+    // and returns false if the character is dying or exploding (its update is
+    // then done); otherwise move is the movement to sweep, and finishUpdate
+    // takes the resulting contact.
+    bool beginUpdate(Vec2& move);
+    void finishUpdate(const PlatformContact& contact);
     void updateAttackPositions();
-    void draw();
+    void draw(float alpha = 1.0f); // Defined in the frontend library
 
     // Death handling
     void startDeathAnimation();
@@ -148,8 +157,13 @@ public:
 
     // Collision and damage
     bool checkHit(Character& other);
-    void applyDamage(float damage);
-    void applyKnockback(float damage, float baseKnockback, float knockbackScaling, float directionX, float directionY);
+    // Apply a hit from one of this character's attacks that overlaps other.
+    // Returns true if it dealt damage (not a grab or a shielded hit), which is
+    // when a hit effect belongs at the contact point. A projectile destroyed
+    // by the hit is left inactive for the caller to expire.
+    bool applyHit(AttackBox& attack, Character& other);
+    void applyDamage(Real damage);
+    void applyKnockback(Real damage, Real baseKnockback, Real knockbackScaling, Real directionX, Real directionY);
     void createHitEffect(Vector2 position);
     bool isOutOfBounds();
 };
@@ -3,36 +3,39 @@
 
 #include "raylib.h"
 #include "../CharacterConfig.h"
-#include <cmath>
+#include "../Real.h"
+#include <algorithm>
 
 class CharacterPhysics
 {
 public:
     CharacterPhysics()
-        : position({0, 0}), velocity({0, 0}), isFastFalling(false)
+        : position{0, 0}, previousPosition{0, 0}, velocity{0, 0}, isFastFalling(false), ground(-1)
     {
     }
 
-    CharacterPhysics(float x, float y)
-        : position({x, y}), velocity({0, 0}), isFastFalling(false)
+    CharacterPhysics(Real x, Real y)
+        : position{x, y}, previousPosition{x, y}, velocity{0, 0}, isFastFalling(false), ground(-1)
     {
     }
 
-    // Core physics properties
-    Vector2 position;
-    Vector2 velocity;
+    // Core physics properties (see Real.h for the number type)
+    Vec2 position;
+    Vec2 previousPosition;   // Position at the start of the current tick
+    Vec2 velocity;
     bool isFastFalling;
+    int ground;              // Platform stood on after the last tick, -1 if none; moving ones carry the character
 
     // Apply gravity based on fast fall state
     void applyGravity()
     {
         if (isFastFalling)
         {
-            velocity.y += GameConfig::FAST_FALL_GRAVITY;
+            velocity.y += Real(GameConfig::FAST_FALL_GRAVITY);
         }
         else
         {
-            velocity.y += GameConfig::GRAVITY;
+            velocity.y += Real(GameConfig::GRAVITY);
         }
     }
 
@@ -45,10 +48,10 @@ public:
             // Original code might have been:
             // float frictionFactor = BASE_FRICTION_FACTOR * (1.0f - (characterDamage / MAX_DAMAGE));
 
-            velocity.x *= GameConfig::GROUND_FRICTION;
+            velocity.x *= Real(GameConfig::GROUND_FRICTION);
 
             // If velocity is very small, just stop completely to prevent sliding
-            if (std::fabs(velocity.x) < 0.1f)
+            if (realAbs(velocity.x) < Real(0.1f))
             {
                 velocity.x = 0.0f;
             }
@@ -56,13 +59,13 @@ public:
         else
         {
             // While airborne, apply a much smaller amount of air resistance
-            const float AIR_RESISTANCE = 0.98f;
+            const Real AIR_RESISTANCE = 0.98f;
             velocity.x *= AIR_RESISTANCE;
         }
     }
 
     // Set vertical velocity for jumping
-    void jump(float force)
+    void jump(Real force)
     {
         velocity.y = force;
     }
@@ -70,11 +73,11 @@ public:
     // Enable fast falling
     void fastFall()
     {
-        if (velocity.y > 0)
+        if (velocity.y > Real(0))
         {
             // Only if already falling
             isFastFalling = true;
-            velocity.y = std::max(velocity.y, 5.0f); // Minimum fast fall speed
+            velocity.y = std::max(velocity.y, Real(5.0f)); // Minimum fast fall speed
         }
     }
 
@@ -85,7 +88,7 @@ public:
     }
 
     // Move horizontally with specified speed
-    void moveHorizontal(float speed, bool facingRight)
+    void moveHorizontal(Real speed, bool facingRight)
     {
         velocity.x = facingRight ? speed : -speed;
     }
@@ -97,7 +100,7 @@ public:
     }
 
     // Cap vertical velocity to prevent extreme values
-    void capVerticalVelocity(float maxVelocity)
+    void capVerticalVelocity(Real maxVelocity)
     {
         if (velocity.y > maxVelocity)
         {
@@ -109,6 +112,31 @@ public:
         }
     }
 
+    // Remember where this tick started so rendering can blend between ticks
+    void beginTick()
+    {
+        previousPosition = position;
+    }
+
+    // Drop the previous tick after a teleport (respawn) so it is not blended
+    // across, and the platform stood on so it does not carry the character
+    void resetInterpolation()
+    {
+        previousPosition = position;
+        ground = -1;
+    }
+
+    // Position blended between the last two ticks (alpha 0 = previous, 1 = current)
+    Vector2 interpolatedPosition(float alpha) const
+    {
+        Vector2 previous = previousPosition;
+        Vector2 current = position;
+        return {
+            previous.x + (current.x - previous.x) * alpha,
+            previous.y + (current.y - previous.y) * alpha
+        };
+    }
+
     // Move position by current velocity
     void updatePosition()
     {
@@ -117,7 +145,7 @@ public:
     }
 
     // Move position by partial velocity (for collision detection)
-    void updatePositionPartial(float stepX, float stepY)
+    void updatePositionPartial(Real stepX, Real stepY)
     {
         position.x += stepX;
         position.y += stepY;
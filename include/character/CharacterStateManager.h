@@ -4,6 +4,7 @@
 #include "../CharacterConfig.h"
 #include "CharacterState.h"
 #include "Cooldown.h"
+#include "../Real.h"
 #include <algorithm>
 
 using CharacterState::State;
@@ -59,7 +60,7 @@ public:
     bool isAttacking;
     bool canAttack;
     bool isShielding;
-    float shieldHealth;
+    Real shieldHealth;
     bool isDodging;
     int dodgeFrames;
     bool isHitstun;
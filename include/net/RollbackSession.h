@@ -0,0 +1,100 @@
+#ifndef ROLLBACK_SESSION_H
+#define ROLLBACK_SESSION_H
+
+#include "../PlayerInput.h"
+#include "UdpTransport.h"
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+class World;
+
+// GGPO-style rollback for a two-player match.
+//
+// Every frame runs immediately with the local input and a prediction of the
+// remote one (the last input the peer confirmed). Each frame's world snapshot
+// is kept, and when a remote input arrives that differs from what was predicted
+// the world is restored to that frame and re-simulated up to the present with
+// cosmetics turned off. The local side waits rather than running more than
+// maxRollbackFrames ahead of the last confirmed remote input.
+//
+// Packet layout (little endian):
+//   "VBNP", version byte
+//   ack i32 (last remote frame this side has confirmed, -1 for none)
+//   start i32, count u8, then count u16 button masks for frames start..start+count-1
+class RollbackSession
+{
+public:
+    static const int DEFAULT_MAX_ROLLBACK_FRAMES = 8;
+
+    // world must be built identically (same stage and seed) on both machines.
+    // localPlayer is the slot (0 or 1) driven by this machine's input.
+    RollbackSession(World& world, UdpTransport& transport, int localPlayer,
+                    int maxRollbackFrames = DEFAULT_MAX_ROLLBACK_FRAMES);
+
+    // Run one frame with this machine's input.
+    // Returns false, leaving the world untouched, while waiting on the peer.
+    bool advance(const PlayerInput& localInput);
+
+    // Exchange packets and apply corrections without advancing (e.g. while paused)
+    void poll();
+
+    // Next frame to be simulated
+    int getFrame() const { return frame; }
+
+    // Last frame whose remote input has arrived
+    int getConfirmedFrame() const { return confirmedRemoteFrame; }
+
+    // True when every simulated frame used real inputs, so the world cannot change anymore
+    bool isSynchronized() const { return confirmedRemoteFrame >= frame - 1 && firstMispredictedFrame < 0; }
+
+    // Frames re-simulated by the most recent rollback, and in total
+    int getLastRollbackFrames() const { return lastRollbackFrames; }
+    int getTotalRollbackFrames() const { return totalRollbackFrames; }
+
+private:
+    // State before a frame ran and the inputs it ran with
+    struct FrameRecord {
+        std::vector<uint8_t> snapshot;
+        PlayerInput inputs[2];
+    };
+
+    World& world;
+    UdpTransport& transport;
+    int localPlayer;
+    int remotePlayer;
+    int maxRollbackFrames;
+
+    int frame;
+    std::vector<FrameRecord> history; // Ring buffer indexed by frame
+
+    // Local inputs the peer has not acknowledged yet, starting at unackedLocalFrame
+    std::deque<PlayerInput> unackedLocalInputs;
+    int unackedLocalFrame;
+
+    // Remote inputs received so far
+    int confirmedRemoteFrame;
+    PlayerInput lastRemoteInput;
+    std::deque<PlayerInput> remoteInputs; // Starting at remoteInputsFrame
+    int remoteInputsFrame;
+
+    // Earliest frame simulated with a wrong prediction, -1 when none
+    int firstMispredictedFrame;
+
+    int lastRollbackFrames;
+    int totalRollbackFrames;
+
+    std::vector<uint8_t> packet;
+
+    FrameRecord& recordFor(int frameNumber);
+    PlayerInput remoteInputFor(int frameNumber) const;
+    void runFrame(int frameNumber, const PlayerInput& localInput);
+    void rollback();
+
+    void receivePackets();
+    void handlePacket(const std::vector<uint8_t>& bytes);
+    void confirmRemoteInput(int frameNumber, const PlayerInput& input);
+    void sendInputs();
+};
+
+#endif // ROLLBACK_SESSION_H
@@ -0,0 +1,68 @@
+#ifndef UDP_TRANSPORT_H
+#define UDP_TRANSPORT_H
+
+#include "../Random.h"
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+// Artificial network conditions applied to outgoing packets.
+// Lets rollback be exercised over localhost as if the peer were far away.
+struct NetworkConditions {
+    int delayMs;     // One-way latency added to every packet
+    int jitterMs;    // Extra random latency in [0, jitterMs]
+    float lossRate;  // Fraction of packets dropped, 0..1
+
+    NetworkConditions() : delayMs(0), jitterMs(0), lossRate(0.0f) {}
+};
+
+// Non-blocking, connectionless UDP link to a single peer
+class UdpTransport
+{
+public:
+    UdpTransport();
+    ~UdpTransport();
+
+    UdpTransport(const UdpTransport&) = delete;
+    UdpTransport& operator=(const UdpTransport&) = delete;
+
+    // Bind localPort and address packets to remoteHost:remotePort.
+    // Returns false if the socket cannot be created, bound or the host resolved.
+    bool open(uint16_t localPort, const std::string& remoteHost, uint16_t remotePort);
+    void close();
+    bool isOpen() const;
+
+    void setConditions(const NetworkConditions& networkConditions);
+
+    // Queue a datagram; it leaves once its emulated delay has passed
+    void send(const std::vector<uint8_t>& packet);
+
+    // Flush queued datagrams whose delay has passed; call once per frame
+    void update();
+
+    // Next datagram from the peer, false when none is waiting
+    bool receive(std::vector<uint8_t>& packet);
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    struct PendingPacket {
+        Clock::time_point sendAt;
+        std::vector<uint8_t> bytes;
+    };
+
+    std::intptr_t socketHandle; // -1 when closed
+    std::vector<uint8_t> remoteAddress; // sockaddr_in bytes
+    NetworkConditions conditions;
+    std::deque<PendingPacket> outgoing;
+
+    // Loss and jitter rolls; separate from the match streams so the
+    // emulator can never influence the simulation
+    Random random;
+
+    void sendNow(const std::vector<uint8_t>& packet);
+};
+
+#endif // UDP_TRANSPORT_H
@@ -5,11 +5,14 @@
 #include "Platform.h"
 #include "Constants.h"
 #include "CharacterConfig.h"
+#include "Random.h"
 #include <algorithm>
 #include <cmath>
 #include <random>
 
 // Use enum directly without namespace
+using CharacterState::IDLE;
+
 using AttackType::JAB;
 using AttackType::FORWARD_TILT;
 using AttackType::UP_TILT;
@@ -46,7 +49,7 @@ void AIDecisionMaker::DetermineNextAction(std::vector<Character*>& players,
     // Skip state transition if reaction delay hasn't elapsed
     // This simulates human reaction time
     int reactionDelay = static_cast<int>(config.difficulty.reactionTimeBase +
-        (GetRandomValue(0, 100) / 100.0f) *
+        (gameplayRandom(0, 100) / 100.0f) *
         config.difficulty.reactionTimeVariance *
         (1.0f - config.difficulty.decisionQuality));
     
@@ -232,7 +235,7 @@ void AIDecisionMaker::DetermineNextAction(std::vector<Character*>& players,
     }
 
     // NEUTRAL - when assessing the situation
-    if (absDistanceX > 200 || (enemy->stateManager.state == IDLE && GetRandomValue(0, 100) < 10))
+    if (absDistanceX > 200 || (enemy->stateManager.state == IDLE && gameplayRandom(0, 100) < 10))
     {
         float neutralPriority = 2.0f;
         stateOptions.push_back({EnhancedAIState::NEUTRAL, neutralPriority});
@@ -269,7 +272,7 @@ void AIDecisionMaker::DetermineNextAction(std::vector<Character*>& players,
         for (auto& option : stateOptions)
         {
             float randomAdjust = (1.0f - config.difficulty.decisionQuality) * 3.0f *
-                ((float)GetRandomValue(-100, 100) / 100.0f);
+                ((float)gameplayRandom(-100, 100) / 100.0f);
             option.second += randomAdjust;
         }
     }
@@ -395,7 +398,7 @@ float AIDecisionMaker::PredictReward(Character* enemy, Character* player, int st
 
     case EnhancedAIState::COMBO:
         // High reward, especially at lower damage percentages
-        reward = 0.7f + ((100.0f - std::min(100.0f, player->damagePercent)) / 100.0f) * 0.3f;
+        reward = 0.7f + ((100.0f - std::min(100.0f, player->getDamagePercent())) / 100.0f) * 0.3f;
         break;
 
     case EnhancedAIState::RECOVER:
@@ -517,7 +520,7 @@ void AIDecisionMaker::UpdateThreatLevel(EnhancedAIState& aiState, Character* pla
         (positionThreat * 0.1f);
 
     // Add random noise based on difficulty (lower difficulty = more inconsistent threat assessment)
-    float randomFactor = (1.0f - config.difficulty.decisionQuality) * 0.2f * ((float)GetRandomValue(-100, 100) /
+    float randomFactor = (1.0f - config.difficulty.decisionQuality) * 0.2f * ((float)gameplayRandom(-100, 100) /
         100.0f);
     threatLevel = std::min(1.0f, std::max(0.0f, threatLevel + randomFactor));
 
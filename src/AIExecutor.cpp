@@ -4,6 +4,7 @@
 #include "Platform.h"
 #include "Constants.h"
 #include "AttackOption.h" // Include specific attack options
+#include "Random.h"
 #include <algorithm>
 #include <cmath>
 
@@ -124,13 +125,13 @@ void AIExecutor::ExecuteNeutralBehavior(Character* enemy, Character* player, flo
     enemy->stateManager.isFacingRight = (player->physics.position.x > enemy->physics.position.x);
 
     // Occasionally shield preemptively
-    if (GetRandomValue(0, 100) < 5 * config.difficulty.executionPrecision)
+    if (gameplayRandom(0, 100) < 5 * config.difficulty.executionPrecision)
     {
         enemy->shield();
     }
 
     // Occasionally jump to platforms
-    if (GetRandomValue(0, 100) < 3 * config.difficulty.executionPrecision &&
+    if (gameplayRandom(0, 100) < 3 * config.difficulty.executionPrecision &&
         enemy->stateManager.state != JUMPING)
     {
         enemy->jump();
@@ -150,7 +151,7 @@ void AIExecutor::ExecuteApproachBehavior(Character* enemy, Character* player, fl
     if (absDistanceX < optimalSpace + 10 && absDistanceX > optimalSpace - 10)
     {
         // At optimal spacing, consider attacking or defending
-        if (GetRandomValue(0, 100) < 30 * config.difficulty.executionPrecision)
+        if (gameplayRandom(0, 100) < 30 * config.difficulty.executionPrecision)
         {
             ExecuteAttackBehavior(enemy, player, distanceX, distanceY);
             return;
@@ -171,7 +172,7 @@ void AIExecutor::ExecuteApproachBehavior(Character* enemy, Character* player, fl
 
     // Jump to approach when needed
     if (distanceY < -80 && absDistanceX < 150 &&
-        GetRandomValue(0, 100) > 70 && enemy->stateManager.isJumping)
+        gameplayRandom(0, 100) > 70 && enemy->stateManager.isJumping)
     {
         enemy->jump();
     }
@@ -179,14 +180,14 @@ void AIExecutor::ExecuteApproachBehavior(Character* enemy, Character* player, fl
     // Dash dance near optimal spacing (advanced technique)
     if (absDistanceX < optimalSpace + 30 && absDistanceX > optimalSpace - 30)
     {
-        if (GetRandomValue(0, 100) < 15 * config.difficulty.executionPrecision)
+        if (gameplayRandom(0, 100) < 15 * config.difficulty.executionPrecision)
         {
             // Briefly dash in opposite direction
             if (distanceX > 0)
             {
                 enemy->moveLeft();
                 // Quick reversal to maintain facing
-                if (GetRandomValue(0, 100) < 80)
+                if (gameplayRandom(0, 100) < 80)
                 {
                     enemy->stateManager.isFacingRight = true;
                 }
@@ -194,7 +195,7 @@ void AIExecutor::ExecuteApproachBehavior(Character* enemy, Character* player, fl
             else
             {
                 enemy->moveRight();
-                if (GetRandomValue(0, 100) < 80)
+                if (gameplayRandom(0, 100) < 80)
                 {
                     enemy->stateManager.isFacingRight = false;
                 }
@@ -204,7 +205,7 @@ void AIExecutor::ExecuteApproachBehavior(Character* enemy, Character* player, fl
 
     // Short hop aerials approach (advanced technique)
     if (absDistanceX < 130 && absDistanceY < 50 &&
-        GetRandomValue(0, 100) > 80 && enemy->stateManager.isJumping)
+        gameplayRandom(0, 100) > 80 && enemy->stateManager.isJumping)
     {
         enemy->jump();
     }
@@ -243,13 +244,13 @@ void AIExecutor::ExecuteAttackBehavior(Character* enemy, Character* player, floa
         enemy->dashAttack();
         break;
     case FORWARD_SMASH:
-        enemy->forwardSmash(GetRandomValue(10, 25) * config.difficulty.executionPrecision);
+        enemy->forwardSmash(gameplayRandom(10, 25) * config.difficulty.executionPrecision);
         break;
     case UP_SMASH:
-        enemy->upSmash(GetRandomValue(10, 25) * config.difficulty.executionPrecision);
+        enemy->upSmash(gameplayRandom(10, 25) * config.difficulty.executionPrecision);
         break;
     case DOWN_SMASH:
-        enemy->downSmash(GetRandomValue(10, 25) * config.difficulty.executionPrecision);
+        enemy->downSmash(gameplayRandom(10, 25) * config.difficulty.executionPrecision);
         break;
     case NEUTRAL_AIR:
         enemy->neutralAir();
@@ -290,7 +291,7 @@ void AIExecutor::ExecuteAttackBehavior(Character* enemy, Character* player, floa
     // Handle throws if grabbing
     if (enemy->stateManager.isGrabbing)
     {
-        int throwChoice = GetRandomValue(0, 100);
+        int throwChoice = gameplayRandom(0, 100);
 
         // Choose optimal throw based on position and damage
         if (player->damagePercent > 100 && enemy->physics.position.x < 200)
@@ -354,10 +355,10 @@ void AIExecutor::ExecutePressureBehavior(Character* enemy, Character* player, fl
     }
 
     // Use safe, quick attacks to maintain pressure
-    int frameCount = GetRandomValue(0, 100);
+    int frameCount = gameplayRandom(0, 100);
     if (frameCount % 20 == 0)
     {
-        int attackChoice = GetRandomValue(0, 100);
+        int attackChoice = gameplayRandom(0, 100);
 
         if (attackChoice < 30)
         {
@@ -405,7 +406,7 @@ void AIExecutor::ExecuteBaitBehavior(Character* enemy, Character* player, float
     enemy->stateManager.isFacingRight = (distanceX > 0);
 
     // Dash dance (move back and forth) to bait attacks
-    int frameCount = GetRandomValue(0, 100);
+    int frameCount = gameplayRandom(0, 100);
     int dashFrame = frameCount % 20;
 
     if (dashFrame < 10)
@@ -464,7 +465,7 @@ void AIExecutor::ExecuteDefendBehavior(Character* enemy, Character* player, floa
     // If player is attacking, choose best defensive option
     if (player->stateManager.isAttacking)
     {
-        int defenseChoice = GetRandomValue(0, 100);
+        int defenseChoice = gameplayRandom(0, 100);
 
         // Perfect shielding (precise timing)
         if (defenseChoice < 40 * config.difficulty.executionPrecision &&
@@ -496,7 +497,7 @@ void AIExecutor::ExecuteDefendBehavior(Character* enemy, Character* player, floa
             enemy->jump();
 
             // Air dodge if needed after jump
-            if (GetRandomValue(0, 100) > 70)
+            if (gameplayRandom(0, 100) > 70)
             {
                 float dodgeX = (distanceX > 0) ? -1.0f : 1.0f;
                 float dodgeY = -0.5f;
@@ -508,7 +509,7 @@ void AIExecutor::ExecuteDefendBehavior(Character* enemy, Character* player, floa
     else if (player->stateManager.isGrabbing)
     {
         // Button mashing to escape grabs faster
-        int escapeAction = GetRandomValue(0, 3);
+        int escapeAction = gameplayRandom(0, 3);
         switch (escapeAction)
         {
         case 0: enemy->moveLeft();
@@ -545,7 +546,7 @@ void AIExecutor::ExecutePunishBehavior(Character* enemy, Character* player, floa
         if (absDistanceX < 50 && absDistanceY < 40)
         {
             // Grab punish
-            if (GetRandomValue(0, 100) < 70 * config.difficulty.executionPrecision)
+            if (gameplayRandom(0, 100) < 70 * config.difficulty.executionPrecision)
             {
                 enemy->grab();
             }
@@ -558,7 +559,7 @@ void AIExecutor::ExecutePunishBehavior(Character* enemy, Character* player, floa
         // Mid range punishes
         else if (absDistanceX < 120 && absDistanceY < 60)
         {
-            int punishOption = GetRandomValue(0, 100);
+            int punishOption = gameplayRandom(0, 100);
             if (punishOption < 40)
             {
                 enemy->dashAttack();
@@ -580,7 +581,7 @@ void AIExecutor::ExecutePunishBehavior(Character* enemy, Character* player, floa
         if (player->damagePercent < 50)
         {
             // Low percent - use combo starters
-            if (GetRandomValue(0, 100) < 70)
+            if (gameplayRandom(0, 100) < 70)
             {
                 enemy->upTilt();
             }
@@ -592,7 +593,7 @@ void AIExecutor::ExecutePunishBehavior(Character* enemy, Character* player, floa
         else if (player->damagePercent < 100)
         {
             // Mid percent - use launchers
-            if (GetRandomValue(0, 100) < 60)
+            if (gameplayRandom(0, 100) < 60)
             {
                 enemy->upAir();
             }
@@ -604,7 +605,7 @@ void AIExecutor::ExecutePunishBehavior(Character* enemy, Character* player, floa
         else
         {
             // High percent - use KO moves
-            if (GetRandomValue(0, 100) < 50)
+            if (gameplayRandom(0, 100) < 50)
             {
                 enemy->forwardSmash(20 * config.difficulty.executionPrecision);
             }
@@ -643,8 +644,8 @@ void AIExecutor::ExecuteRecoverBehavior(Character* enemy, const std::vector<Plat
         targetX = mainPlatform.x + mainPlatform.width / 2;
         
         // Random targeting errors for low skill
-        if (GetRandomValue(0, 100) > 70) {
-            targetX += GetRandomValue(-100, 100);
+        if (gameplayRandom(0, 100) > 70) {
+            targetX += gameplayRandom(-100, 100);
         }
     } else {
         // Higher skill intelligently picks closest point
@@ -696,9 +697,9 @@ void AIExecutor::ExecuteRecoverBehavior(Character* enemy, const std::vector<Plat
     }
 
     // Low skill AI may make input errors based on executionPrecision
-    if (config.difficulty.executionPrecision < 0.5f && GetRandomValue(0, 100) > 80) {
+    if (config.difficulty.executionPrecision < 0.5f && gameplayRandom(0, 100) > 80) {
         // Sometimes moves in wrong direction
-        if (GetRandomValue(0, 1) == 0) {
+        if (gameplayRandom(0, 1) == 0) {
             enemy->moveLeft();
         } else {
             enemy->moveRight();
@@ -736,7 +737,7 @@ void AIExecutor::ExecuteRecoverBehavior(Character* enemy, const std::vector<Plat
         }
         
         // Input errors for low skill
-        if (config.difficulty.executionPrecision < 0.3f && GetRandomValue(0, 100) > 70) {
+        if (config.difficulty.executionPrecision < 0.3f && gameplayRandom(0, 100) > 70) {
             // Sometimes fails to input jump
             shouldJump = false;
         }
@@ -756,7 +757,7 @@ void AIExecutor::ExecuteRecoverBehavior(Character* enemy, const std::vector<Plat
         
         // Low skill uses up special randomly or too early
         if (config.difficulty.recoverySkill < 0.4f) {
-            shouldUpSpecial = (GetRandomValue(0, 100) > 50);
+            shouldUpSpecial = (gameplayRandom(0, 100) > 50);
         }
         // Medium skill uses up special when in danger
         else if (config.difficulty.recoverySkill < 0.7f) {
@@ -778,7 +779,7 @@ void AIExecutor::ExecuteRecoverBehavior(Character* enemy, const std::vector<Plat
         }
         
         // Input errors for low skill
-        if (config.difficulty.executionPrecision < 0.3f && GetRandomValue(0, 100) > 70) {
+        if (config.difficulty.executionPrecision < 0.3f && gameplayRandom(0, 100) > 70) {
             // Sometimes fails to input special
             shouldUpSpecial = false;
         }
@@ -795,7 +796,7 @@ void AIExecutor::ExecuteRecoverBehavior(Character* enemy, const std::vector<Plat
         enemy->stateManager.specialUpCD.current > 0 && !enemy->stateManager.isDodging)
     {
         // Only high skill AI uses air dodge effectively for recovery
-        if (config.difficulty.techSkill > 0.5f && GetRandomValue(0, 100) > 50) {
+        if (config.difficulty.techSkill > 0.5f && gameplayRandom(0, 100) > 50) {
             // Calculate best air dodge angle for recovery - more precise
             float dodgeX = (enemy->physics.position.x < targetX) ? 0.7f : -0.7f;
             // Adjust vertical component based on how far down we are
@@ -809,8 +810,8 @@ void AIExecutor::ExecuteRecoverBehavior(Character* enemy, const std::vector<Plat
             
             // Less skilled AI might use suboptimal angles
             if (config.difficulty.recoverySkill < 0.7f) {
-                dodgeX += (GetRandomValue(-30, 30) / 100.0f);
-                dodgeY += (GetRandomValue(-20, 20) / 100.0f);
+                dodgeX += (gameplayRandom(-30, 30) / 100.0f);
+                dodgeY += (gameplayRandom(-20, 20) / 100.0f);
             }
             
             enemy->airDodge(dodgeX, dodgeY);
@@ -824,7 +825,7 @@ void AIExecutor::ExecuteRecoverBehavior(Character* enemy, const std::vector<Plat
         if (!enemy->stateManager.isJumping && enemy->stateManager.hasDoubleJump)
         {
             // Low skill might panic and miss inputs
-            if (config.difficulty.executionPrecision < 0.3f && GetRandomValue(0, 100) > 60) {
+            if (config.difficulty.executionPrecision < 0.3f && gameplayRandom(0, 100) > 60) {
                 // Do nothing - panicking
             } else {
                 enemy->jump();
@@ -833,7 +834,7 @@ void AIExecutor::ExecuteRecoverBehavior(Character* enemy, const std::vector<Plat
         else if (enemy->stateManager.specialUpCD.current <= 0)
         {
             // Low skill might panic and miss inputs
-            if (config.difficulty.executionPrecision < 0.3f && GetRandomValue(0, 100) > 60) {
+            if (config.difficulty.executionPrecision < 0.3f && gameplayRandom(0, 100) > 60) {
                 // Do nothing - panicking
             } else {
                 enemy->upSpecial();
@@ -885,7 +886,7 @@ void AIExecutor::ExecuteRetreatBehavior(Character* enemy, Character* player, flo
                 enemy->shield();
             } else {
                 // Player is far enough, use projectile or prepare to counterattack
-                if (GetRandomValue(0, 1) == 0) {
+                if (gameplayRandom(0, 1) == 0) {
                     enemy->neutralSpecial();
                 } else {
                     // Ready position, no action
@@ -904,7 +905,7 @@ void AIExecutor::ExecuteRetreatBehavior(Character* enemy, Character* player, flo
                 enemy->shield();
             } else {
                 // Player is far enough, use projectile or prepare to counterattack
-                if (GetRandomValue(0, 1) == 0) {
+                if (gameplayRandom(0, 1) == 0) {
                     enemy->neutralSpecial();
                 } else {
                     // Ready position, no action
@@ -927,7 +928,7 @@ void AIExecutor::ExecuteRetreatBehavior(Character* enemy, Character* player, flo
                    (enemy->physics.position.x < leftBoundary + 60) || 
                    (enemy->physics.position.x > rightBoundary - 60);
     
-    if (!nearEdge && std::fabs(distanceX) < 150 && GetRandomValue(0, 100) > 80) // Greatly reduced frequency of jumps
+    if (!nearEdge && std::fabs(distanceX) < 150 && gameplayRandom(0, 100) > 80) // Greatly reduced frequency of jumps
     {
         enemy->jump();
     }
@@ -935,7 +936,7 @@ void AIExecutor::ExecuteRetreatBehavior(Character* enemy, Character* player, flo
     // Use projectiles to keep player away, especially if at boundary
     bool shouldUseProjectile = (atLeftBoundary && distanceX < 0) || 
                               (atRightBoundary && distanceX > 0) ||
-                              (std::fabs(distanceX) > 100 && GetRandomValue(0, 100) > 60);
+                              (std::fabs(distanceX) > 100 && gameplayRandom(0, 100) > 60);
                               
     if (shouldUseProjectile) 
     {
@@ -959,7 +960,7 @@ void AIExecutor::ExecuteRetreatBehavior(Character* enemy, Character* player, flo
     // If near edge and player is approaching, consider counterattack
     if ((atLeftBoundary || atRightBoundary) && 
         std::fabs(distanceX) < 120 && std::fabs(distanceX) > 50 &&
-        GetRandomValue(0, 100) > 70)
+        gameplayRandom(0, 100) > 70)
     {
         // Choose a quick counterattack when cornered
         enemy->jab();
@@ -994,13 +995,13 @@ void AIExecutor::ExecuteEdgeGuardBehavior(Character* enemy, Character* player, f
             if (std::fabs(enemy->physics.position.x - edgeX) < 50)
             {
                 // Occasionally charge a smash attack at edge
-                if (GetRandomValue(0, 100) > 50)
+                if (gameplayRandom(0, 100) > 50)
                 {
-                    enemy->downSmash(GetRandomValue(10, 30) * config.difficulty.executionPrecision);
+                    enemy->downSmash(gameplayRandom(10, 30) * config.difficulty.executionPrecision);
                 }
 
                 // Or prepare to intercept with an aerial
-                if (GetRandomValue(0, 100) > 60)
+                if (gameplayRandom(0, 100) > 60)
                 {
                     // Jump off stage to intercept
                     enemy->jump();
@@ -1013,7 +1014,7 @@ void AIExecutor::ExecuteEdgeGuardBehavior(Character* enemy, Character* player, f
             // Jump off stage for aggressive edge guard
             if (enemy->stateManager.isJumping &&
                 enemy->stateManager.state != FALLING &&
-                GetRandomValue(0, 100) > 40)
+                gameplayRandom(0, 100) > 40)
             {
                 enemy->jump();
             }
@@ -1052,11 +1053,11 @@ void AIExecutor::ExecuteEdgeGuardBehavior(Character* enemy, Character* player, f
         if (std::fabs(player->physics.position.y - enemy->physics.position.y) < 100)
         {
             // Use projectiles or side special to intercept
-            if (GetRandomValue(0, 100) > 60)
+            if (gameplayRandom(0, 100) > 60)
             {
                 enemy->neutralSpecial();
             }
-            else if (GetRandomValue(0, 100) > 70)
+            else if (gameplayRandom(0, 100) > 70)
             {
                 enemy->sideSpecial();
             }
@@ -1086,7 +1087,7 @@ void AIExecutor::ExecuteLedgeTrapBehavior(Character* enemy, Character* player, f
     enemy->stateManager.isFacingRight = (ledgeX > enemy->physics.position.x);
 
     // Dash dance near ledge to bait and react
-    if (GetRandomValue(0, 100) < 30)
+    if (gameplayRandom(0, 100) < 30)
     {
         if (enemy->physics.position.x < optimalX)
         {
@@ -1101,13 +1102,13 @@ void AIExecutor::ExecuteLedgeTrapBehavior(Character* enemy, Character* player, f
     // React based on player position
     if (std::fabs(enemy->physics.position.x - optimalX) < 30)
     {
-        int option = GetRandomValue(0, 100);
+        int option = gameplayRandom(0, 100);
 
         // Options to cover different ledge getup options
         if (option < 25)
         {
             // Cover neutral getup with jab or grab
-            if (GetRandomValue(0, 100) < 60)
+            if (gameplayRandom(0, 100) < 60)
             {
                 enemy->jab();
             }
@@ -1182,10 +1183,10 @@ int AIExecutor::ChooseBestAttack(Character* enemy, Character* player, float dist
     if (config.difficulty.executionPrecision < 1.0f && attackUtilities.size() > 1)
     {
         // Chance to pick suboptimal attack increases as difficulty decreases
-        if (GetRandomValue(0, 100) < (1.0f - config.difficulty.executionPrecision) * 40.0f)
+        if (gameplayRandom(0, 100) < (1.0f - config.difficulty.executionPrecision) * 40.0f)
         {
             // Pick randomly from top 3 options or all options if fewer than 3
-            int randomIndex = GetRandomValue(0, std::min(2, (int)attackUtilities.size() - 1));
+            int randomIndex = gameplayRandom(0, std::min(2, (int)attackUtilities.size() - 1));
             return attackUtilities[randomIndex].first;
         }
     }
@@ -1269,10 +1270,10 @@ void AIExecutor::ApplyDirectionalInfluence(Character* enemy)
     }
 
     // Wiggle inputs to escape grabs faster (if grabbed)
-    if (enemy->stateManager.isHitstun && GetRandomValue(0, 100) < 80 * config.difficulty.executionPrecision)
+    if (enemy->stateManager.isHitstun && gameplayRandom(0, 100) < 80 * config.difficulty.executionPrecision)
     {
         // Simulate directional inputs to escape grab faster
-        int escapeAction = GetRandomValue(0, 3);
+        int escapeAction = gameplayRandom(0, 3);
         switch (escapeAction)
         {
         case 0: enemy->physics.velocity.x += 0.1f;
@@ -0,0 +1,272 @@
+#include "Collision.h"
+#include <algorithm>
+
+namespace
+{
+    // A box snapped onto a top can sit a rounding error below it; it still
+    // counts as having come from above
+    const Real CONTACT_SLOP = 0.01f;
+
+    // SOLID sides let a box through while its feet are this close to the top
+    const Real STEP_HEIGHT = 5.0f;
+
+    // Each contact stops one axis, so the box is done after hitting a top,
+    // hitting a side and moving on with nothing left
+    const int MAX_SWEEPS = 3;
+
+    enum Face
+    {
+        FACE_NONE,
+        FACE_TOP,
+        FACE_SIDE
+    };
+
+    // The platform that carries a box standing on it, or -1: only moving
+    // platforms carry, and an index from before the stage changed carries nothing
+    int carrierOf(int ground, const std::vector<Platform>& platforms)
+    {
+        if (ground < 0 || ground >= static_cast<int>(platforms.size()))
+        {
+            return -1;
+        }
+        const Vector2& motion = platforms[ground].motion;
+        return motion.x != 0.0f || motion.y != 0.0f ? ground : -1;
+    }
+
+    // Everything a box can touch overlaps this: sliding only ever gives up part of the move
+    Rectangle sweptBox(Real x, Real y, Real halfWidth, Real halfHeight, Real deltaX, Real deltaY)
+    {
+        return {
+            std::min(x, x + deltaX) - halfWidth,
+            std::min(y, y + deltaY) - halfHeight,
+            halfWidth + halfWidth + realAbs(deltaX),
+            halfHeight + halfHeight + realAbs(deltaY)
+        };
+    }
+
+    // delta already includes the carrier's motion, if there is a carrier
+    PlatformContact sweepCandidates(Vec2 position, Real halfWidth, Real halfHeight, Vec2 delta, int carrier,
+                                    const std::vector<Platform>& platforms, const std::vector<int>& candidates)
+    {
+        const Real zero = 0.0f;
+        const Real one = 1.0f;
+        PlatformContact result = {position, false, false, -1};
+        Real width = halfWidth + halfWidth;
+        Real height = halfHeight + halfHeight;
+
+        // Share of the tick still to sweep; moving platforms have that much of their step left
+        Real remaining = one;
+
+        // A box that is not moving can still be run into by a moving platform
+        bool nearMoving = false;
+        for (int index : candidates)
+        {
+            const Vector2& motion = platforms[index].motion;
+            nearMoving = nearMoving || motion.x != 0.0f || motion.y != 0.0f;
+        }
+
+        for (int sweep = 0; sweep < MAX_SWEEPS && (nearMoving || delta.x != zero || delta.y != zero); sweep++)
+        {
+            Real left = result.position.x - halfWidth;
+            Real right = result.position.x + halfWidth;
+            Real top = result.position.y - halfHeight;
+            Real bottom = result.position.y + halfHeight;
+
+            // Earliest contact along delta; ties go to tops, then to the first platform
+            Real hitTime = one;
+            Face hitFace = FACE_NONE;
+            int hitPlatform = -1;
+            Real stopX = zero;
+
+            for (int index : candidates)
+            {
+                const Rectangle& bounds = platforms[index].rect;
+                bool solid = platforms[index].type == SOLID;
+
+                // Platform edges in the physics number type
+                Real rectLeft = bounds.x;
+                Real rectTop = bounds.y;
+                Real rectRight = bounds.x + bounds.width;
+                Real rectBottom = bounds.y + bounds.height;
+                Real rectMiddle = bounds.y + bounds.height / 2;
+
+                // The box's move as seen from the platform; a moving platform
+                // is put back to where it is at this point of the tick
+                Vec2 move = delta;
+                Real shiftX = zero;
+                Real shiftY = zero;
+                const Vector2& motion = platforms[index].motion;
+                if (motion.x != 0.0f || motion.y != 0.0f)
+                {
+                    shiftX = Real(motion.x) * remaining;
+                    shiftY = Real(motion.y) * remaining;
+                    rectLeft -= shiftX;
+                    rectRight -= shiftX;
+                    rectTop -= shiftY;
+                    rectBottom -= shiftY;
+                    rectMiddle -= shiftY;
+                    move.x -= shiftX;
+                    move.y -= shiftY;
+                }
+
+                // A carried box that is not moving up or down relative to its
+                // platform is still standing on it
+                bool riding = index == carrier && move.y == zero;
+
+                if (index != result.ground && ((move.y > zero && bottom + move.y > rectTop) || riding))
+                {
+                    Real reach = rectTop + CONTACT_SLOP;
+                    if (solid)
+                    {
+                        reach = std::max(reach, rectMiddle);
+                    }
+
+                    Real time = riding ? zero : std::max(zero, (rectTop - bottom) / move.y);
+                    bool earlier = hitFace == FACE_NONE ? time <= hitTime :
+                        (time < hitTime || (time == hitTime && hitFace == FACE_SIDE));
+                    Real x = left + move.x * time;
+                    if (bottom <= reach && earlier && x < rectRight && x + width > rectLeft)
+                    {
+                        hitTime = time;
+                        hitFace = FACE_TOP;
+                        hitPlatform = index;
+                    }
+                }
+
+                if (!solid || move.x == zero)
+                {
+                    continue;
+                }
+
+                // stop is against the face where the platform ends the tick
+                Real time;
+                Real stop;
+                if (move.x > zero && left < rectLeft && right + move.x > rectLeft)
+                {
+                    time = std::max(zero, (rectLeft - right) / move.x);
+                    stop = rectLeft - halfWidth + shiftX;
+                }
+                else if (move.x < zero && right > rectRight && left + move.x < rectRight)
+                {
+                    time = std::max(zero, (rectRight - left) / move.x);
+                    stop = rectRight + halfWidth + shiftX;
+                }
+                else
+                {
+                    continue;
+                }
+
+                Real y = top + move.y * time;
+                bool earlier = hitFace == FACE_NONE ? time <= hitTime : time < hitTime;
+                if (earlier && y + height > rectTop + STEP_HEIGHT && y < rectBottom)
+                {
+                    hitTime = time;
+                    hitFace = FACE_SIDE;
+                    hitPlatform = index;
+                    stopX = stop;
+                }
+            }
+
+            if (hitFace == FACE_NONE)
+            {
+                result.position.x += delta.x;
+                result.position.y += delta.y;
+                break;
+            }
+
+            result.position.x += delta.x * hitTime;
+            result.position.y += delta.y * hitTime;
+            remaining *= one - hitTime;
+            if (hitFace == FACE_TOP)
+            {
+                result.position.y = Real(platforms[hitPlatform].rect.y) - halfHeight;
+                result.landed = true;
+                result.ground = hitPlatform;
+                delta.x *= one - hitTime;
+                delta.y = zero;
+            }
+            else
+            {
+                result.position.x = stopX;
+                result.blockedX = true;
+                delta.x = zero;
+                delta.y *= one - hitTime;
+            }
+        }
+
+        return result;
+    }
+}
+
+PlatformContact sweepPlatforms(Vec2 position, float width, float height, Vec2 delta,
+                               const std::vector<Platform>& platforms, const PlatformGrid& grid, int ground)
+{
+    int carrier = carrierOf(ground, platforms);
+    if (carrier >= 0)
+    {
+        delta.x += Real(platforms[carrier].motion.x);
+        delta.y += Real(platforms[carrier].motion.y);
+    }
+
+    Real halfWidth = width / 2;
+    Real halfHeight = height / 2;
+    thread_local std::vector<int> candidates;
+    grid.query(sweptBox(position.x, position.y, halfWidth, halfHeight, delta.x, delta.y), candidates);
+    return sweepCandidates(position, halfWidth, halfHeight, delta, carrier, platforms, candidates);
+}
+
+void CollisionBatch::clear()
+{
+    positionX.clear();
+    positionY.clear();
+    halfWidth.clear();
+    halfHeight.clear();
+    deltaX.clear();
+    deltaY.clear();
+    ground.clear();
+    contacts.clear();
+}
+
+int CollisionBatch::add(Vec2 position, float width, float height, Vec2 delta, int standingOn)
+{
+    positionX.push_back(position.x);
+    positionY.push_back(position.y);
+    halfWidth.push_back(width / 2);
+    halfHeight.push_back(height / 2);
+    deltaX.push_back(delta.x);
+    deltaY.push_back(delta.y);
+    ground.push_back(standingOn);
+    return size() - 1;
+}
+
+void CollisionBatch::resolve(const std::vector<Platform>& platforms, const PlatformGrid& grid)
+{
+    int count = size();
+    swept.resize(count);
+    contacts.resize(count);
+
+    // Moving platforms carry whoever stands on them; ground becomes the carrier, or -1
+    for (int i = 0; i < count; i++)
+    {
+        ground[i] = carrierOf(ground[i], platforms);
+        if (ground[i] >= 0)
+        {
+            deltaX[i] += Real(platforms[ground[i]].motion.x);
+            deltaY[i] += Real(platforms[ground[i]].motion.y);
+        }
+    }
+
+    // Swept boxes for every character first: a straight loop over the arrays
+    for (int i = 0; i < count; i++)
+    {
+        swept[i] = sweptBox(positionX[i], positionY[i], halfWidth[i], halfHeight[i], deltaX[i], deltaY[i]);
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        Vec2 position = {positionX[i], positionY[i]};
+        grid.query(swept[i], candidates);
+        contacts[i] = sweepCandidates(position, halfWidth[i], halfHeight[i], {deltaX[i], deltaY[i]}, ground[i],
+                                      platforms, candidates);
+    }
+}
@@ -0,0 +1,18 @@
+#include "Cosmetics.h"
+
+namespace {
+    thread_local bool enabledOnThread = true;
+}
+
+CosmeticsScope::CosmeticsScope(bool enabled)
+    : previous(enabledOnThread) {
+    enabledOnThread = enabled;
+}
+
+CosmeticsScope::~CosmeticsScope() {
+    enabledOnThread = previous;
+}
+
+bool cosmeticsEnabled() {
+    return enabledOnThread;
+}
@@ -4,9 +4,15 @@
 #include "Platform.h"
 #include "Constants.h"
 #include "CharacterConfig.h"
+#include "Snapshot.h"
+#include "Profiler.h"
 #include <algorithm>
 #include <cmath>
 
+// Use enums directly
+using CharacterState::JUMPING;
+using CharacterState::FALLING;
+
 // Use the AttackType enum directly
 using AttackType::JAB;
 using AttackType::FORWARD_TILT;
@@ -27,7 +33,10 @@ using AttackType::UP_SPECIAL;
 using AttackType::DOWN_SPECIAL;
 
 EnhancedAIController::EnhancedAIController()
-    : frameCount(0),
+    : controlledIndex(1),
+      opponentIndex(0),
+      matchup(2, nullptr),
+      frameCount(0),
       wasComboEffective(false),
       shouldFeint(false),
       lastDIEffectiveness(0.5f) {
@@ -42,11 +51,14 @@ EnhancedAIController::EnhancedAIController()
 }
 
 void EnhancedAIController::Update(std::vector<Character*>& players, std::vector<Platform>& platforms) {
-    // Make sure we have at least two players
-    if (players.size() < 2) return;
+    PROFILE_SCOPE("EnhancedAIController::Update");
+
+    // Make sure both of our slots exist
+    if (static_cast<int>(players.size()) <= std::max(controlledIndex, opponentIndex)) return;
 
-    Character* player = players[0];
-    Character* enemy = players[1];
+    // "enemy" is the character this AI drives, "player" its opponent
+    Character* player = players[opponentIndex];
+    Character* enemy = players[controlledIndex];
 
     // Skip AI update if the enemy is dead or dying
     if (enemy->stocks <= 0 || enemy->stateManager.isDying) return;
@@ -85,7 +97,14 @@ void EnhancedAIController::Update(std::vector<Character*>& players, std::vector<
     executor->SetPlatforms(&platforms);
 
     // Determine the best AI state based on current situation
-    decisionMaker->DetermineNextAction(players, platforms, *aiState);
+    matchup[0] = player;
+    matchup[1] = enemy;
+    {
+        PROFILE_SCOPE("DetermineNextAction");
+        decisionMaker->DetermineNextAction(matchup, platforms, *aiState);
+    }
+
+    PROFILE_SCOPE("executor");
 
     // Special case for combo behavior which needs to track state
     if (aiState->GetCurrentState() == EnhancedAIState::COMBO) {
@@ -99,7 +118,21 @@ void EnhancedAIController::Update(std::vector<Character*>& players, std::vector<
 void EnhancedAIController::SetDifficulty(float difficulty) {
     // Clamp difficulty to valid range
     config.SetDifficulty(std::max(0.0f, std::min(1.0f, difficulty)));
+    ApplyConfig();
+}
+
+void EnhancedAIController::SetConfig(const AIConfig& newConfig) {
+    // Assign in place; the decision maker and executor hold references to config
+    config = newConfig;
+    ApplyConfig();
+}
+
+void EnhancedAIController::SetPlayerSlots(int controlledSlot, int opponentSlot) {
+    controlledIndex = controlledSlot;
+    opponentIndex = opponentSlot;
+}
 
+void EnhancedAIController::ApplyConfig() {
     // Update reaction times based on difficulty
     int reactionDelay = static_cast<int>(15.0f - (config.difficulty.decisionQuality * 10.0f));
     aiState->decisionDelay = reactionDelay;
@@ -112,6 +145,26 @@ float EnhancedAIController::GetDifficulty() const {
     return config.difficulty.decisionQuality;
 }
 
+void EnhancedAIController::SaveSnapshot(SnapshotWriter& writer) const {
+    // The decision maker and executor only hold derived data and a reference to config
+    writer.write(config);
+    writer.write(frameCount);
+    writer.write(wasComboEffective);
+    writer.write(shouldFeint);
+    writer.write(lastDIEffectiveness);
+    aiState->SaveSnapshot(writer);
+}
+
+void EnhancedAIController::RestoreSnapshot(SnapshotReader& reader) {
+    // Overwrite config in place so the components' references stay valid
+    reader.read(config);
+    reader.read(frameCount);
+    reader.read(wasComboEffective);
+    reader.read(shouldFeint);
+    reader.read(lastDIEffectiveness);
+    aiState->RestoreSnapshot(reader);
+}
+
 EnhancedAIState::State EnhancedAIController::GetCurrentState() const {
     return aiState->GetCurrentState();
 }
@@ -120,6 +173,16 @@ float EnhancedAIController::GetCurrentConfidence() const {
     return aiState->GetExpectedReward();
 }
 
+void EnhancedAIController::OnHit(const HitEvent& hit) {
+    if (hit.attacker == controlledIndex && hit.victim == opponentIndex) {
+        // Remember landing it, and whether a combo was what landed it
+        aiState->lastAttackFrame = frameCount;
+        wasComboEffective = aiState->GetCurrentState() == EnhancedAIState::COMBO;
+    } else if (hit.victim == controlledIndex) {
+        wasComboEffective = false;
+    }
+}
+
 void EnhancedAIController::ExecuteComboBehavior(Character* enemy, Character* player, float distanceX, float distanceY) {
     float absDistanceX = std::fabs(distanceX);
     float absDistanceY = std::fabs(distanceY);
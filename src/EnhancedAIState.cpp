@@ -1,9 +1,18 @@
 // EnhancedAIState.cpp
 #include "EnhancedAIState.h"
 #include "Character.h"
+#include "Snapshot.h"
 #include <algorithm>
 #include <cmath>
 
+// Use enums directly
+using CharacterState::IDLE;
+using CharacterState::RUNNING;
+using CharacterState::JUMPING;
+using CharacterState::FALLING;
+using CharacterState::SHIELDING;
+using CharacterState::DODGING;
+
 EnhancedAIState::EnhancedAIState() {
     currentState = NEUTRAL;
     stateTimer = 0;
@@ -82,7 +91,8 @@ void EnhancedAIState::UpdateState(Character* enemy, Character* player, int frame
     }
 
     // Track player state history
-    if (frameCount % 5 == 0 || player->stateManager.state != playerStateHistory.front()) {
+    if (frameCount % 5 == 0 || playerStateHistory.empty() ||
+        player->stateManager.state != playerStateHistory.front()) {
         playerStateHistory.push_front(player->stateManager.state);
         if (playerStateHistory.size() > 20) {
             playerStateHistory.pop_back();
@@ -147,8 +157,8 @@ void EnhancedAIState::AnalyzePlayerPatterns() {
     playerDefenseLevel = std::min(1.0f, playerDefenseLevel);
 }
 
-bool EnhancedAIState::DetectPlayerHabit(const std::deque<CharacterState>& history,
-                                      CharacterState state, float threshold) {
+bool EnhancedAIState::DetectPlayerHabit(const std::deque<CharacterState::State>& history,
+                                      CharacterState::State state, float threshold) {
     if (history.size() < 5) return false;
 
     int count = 0;
@@ -158,3 +168,183 @@ bool EnhancedAIState::DetectPlayerHabit(const std::deque<CharacterState>& histor
 
     return (float)count / history.size() >= threshold;
 }
+
+namespace {
+    void SaveCombo(SnapshotWriter& writer, const EnhancedAIState::ComboData& combo) {
+        writer.writeArray(combo.sequence);
+        writer.write(combo.startingDamage);
+        writer.write(combo.isFinisher);
+        writer.write(combo.hitstunRemaining);
+    }
+
+    void RestoreCombo(SnapshotReader& reader, EnhancedAIState::ComboData& combo) {
+        reader.readArray(combo.sequence);
+        reader.read(combo.startingDamage);
+        reader.read(combo.isFinisher);
+        reader.read(combo.hitstunRemaining);
+    }
+
+    // std::pair is not trivially copyable, so pairs are written member by member
+    template <typename T>
+    void SaveValue(SnapshotWriter& writer, const T& value) {
+        writer.write(value);
+    }
+
+    template <typename A, typename B>
+    void SaveValue(SnapshotWriter& writer, const std::pair<A, B>& value) {
+        writer.write(value.first);
+        writer.write(value.second);
+    }
+
+    template <typename T>
+    void RestoreValue(SnapshotReader& reader, T& value) {
+        reader.read(value);
+    }
+
+    template <typename A, typename B>
+    void RestoreValue(SnapshotReader& reader, std::pair<A, B>& value) {
+        reader.read(value.first);
+        reader.read(value.second);
+    }
+
+    template <typename Container>
+    void SaveSequence(SnapshotWriter& writer, const Container& values) {
+        writer.write(static_cast<uint32_t>(values.size()));
+        for (const auto& value : values) {
+            SaveValue(writer, value);
+        }
+    }
+
+    template <typename Container>
+    void RestoreSequence(SnapshotReader& reader, Container& values) {
+        uint32_t count;
+        reader.read(count);
+        values.clear();
+        for (uint32_t i = 0; i < count && !reader.hasFailed(); i++) {
+            typename Container::value_type value;
+            RestoreValue(reader, value);
+            values.push_back(value);
+        }
+    }
+}
+
+void EnhancedAIState::SaveSnapshot(SnapshotWriter& writer) const {
+    writer.write(currentState);
+    writer.write(isOffStage);
+    writer.write(playerIsOffStage);
+
+    // Positional flags
+    writer.write(nearLeftEdge);
+    writer.write(nearRightEdge);
+    writer.write(abovePlayer);
+    writer.write(belowPlayer);
+
+    // Combat state
+    writer.write(lastAttackFrame);
+    writer.write(wasPlayerAttacking);
+    writer.write(comboState);
+    writer.write(comboCounter);
+    SaveCombo(writer, currentCombo);
+    writer.write(static_cast<uint32_t>(knownCombos.size()));
+    for (const auto& combo : knownCombos) {
+        SaveCombo(writer, combo);
+    }
+
+    // Timers, distances and assessments
+    writer.write(stateTimer);
+    writer.write(decisionDelay);
+    writer.write(reactionTime);
+    writer.write(adaptiveTimer);
+    writer.write(lastDistanceX);
+    writer.write(lastDistanceY);
+    writer.write(stockAdvantage);
+    writer.write(damageAdvantage);
+    writer.write(currentRiskLevel);
+    writer.write(riskTolerance);
+    writer.write(expectedReward);
+    writer.write(centerControlImportance);
+    writer.write(threatLevel);
+
+    // Player profile
+    writer.write(playerAggressionLevel);
+    writer.write(playerDefenseLevel);
+    writer.write(playerRecoveryPattern);
+    writer.write(playerEdgeHabit);
+    writer.write(playerFavorsGround);
+    writer.write(playerFavorsAerial);
+    writer.write(playerShieldsOften);
+    writer.write(playerRollsOften);
+    writer.write(playerJumpsOutOfCombos);
+
+    // Attack frequencies, sorted by attack so equal states give equal bytes
+    std::vector<std::pair<int, int>> frequencies(playerAttackFrequency.begin(), playerAttackFrequency.end());
+    std::sort(frequencies.begin(), frequencies.end());
+    SaveSequence(writer, frequencies);
+
+    // History
+    SaveSequence(writer, lastPlayerAttacks);
+    SaveSequence(writer, playerPositionHistory);
+    SaveSequence(writer, playerStateHistory);
+}
+
+void EnhancedAIState::RestoreSnapshot(SnapshotReader& reader) {
+    reader.read(currentState);
+    reader.read(isOffStage);
+    reader.read(playerIsOffStage);
+
+    // Positional flags
+    reader.read(nearLeftEdge);
+    reader.read(nearRightEdge);
+    reader.read(abovePlayer);
+    reader.read(belowPlayer);
+
+    // Combat state
+    reader.read(lastAttackFrame);
+    reader.read(wasPlayerAttacking);
+    reader.read(comboState);
+    reader.read(comboCounter);
+    RestoreCombo(reader, currentCombo);
+    uint32_t comboCount;
+    reader.read(comboCount);
+    knownCombos.resize(reader.hasFailed() ? 0 : comboCount);
+    for (auto& combo : knownCombos) {
+        RestoreCombo(reader, combo);
+    }
+
+    // Timers, distances and assessments
+    reader.read(stateTimer);
+    reader.read(decisionDelay);
+    reader.read(reactionTime);
+    reader.read(adaptiveTimer);
+    reader.read(lastDistanceX);
+    reader.read(lastDistanceY);
+    reader.read(stockAdvantage);
+    reader.read(damageAdvantage);
+    reader.read(currentRiskLevel);
+    reader.read(riskTolerance);
+    reader.read(expectedReward);
+    reader.read(centerControlImportance);
+    reader.read(threatLevel);
+
+    // Player profile
+    reader.read(playerAggressionLevel);
+    reader.read(playerDefenseLevel);
+    reader.read(playerRecoveryPattern);
+    reader.read(playerEdgeHabit);
+    reader.read(playerFavorsGround);
+    reader.read(playerFavorsAerial);
+    reader.read(playerShieldsOften);
+    reader.read(playerRollsOften);
+    reader.read(playerJumpsOutOfCombos);
+
+    // Attack frequencies
+    std::vector<std::pair<int, int>> frequencies;
+    RestoreSequence(reader, frequencies);
+    playerAttackFrequency.clear();
+    playerAttackFrequency.insert(frequencies.begin(), frequencies.end());
+
+    // History
+    RestoreSequence(reader, lastPlayerAttacks);
+    RestoreSequence(reader, playerPositionHistory);
+    RestoreSequence(reader, playerStateHistory);
+}
@@ -0,0 +1,73 @@
+#include "Fixed.h"
+
+namespace
+{
+    // Table steps per quarter turn
+    const int QUARTER_STEPS = 256;
+    const int TURN_STEPS = QUARTER_STEPS * 4;
+
+    // Series terms in Q30; pi/2 rounded to that precision
+    const int64_t Q30_ONE = int64_t(1) << 30;
+    const int64_t HALF_PI_Q30 = 1686629713;
+
+    struct SineTable
+    {
+        int32_t values[QUARTER_STEPS + 1];
+
+        // sin(x) = x - x^3/3! + x^5/5! - ..., in integers. Seven terms leave
+        // an error far below one Q16.16 step over the first quadrant.
+        SineTable()
+        {
+            for (int step = 0; step <= QUARTER_STEPS; step++)
+            {
+                int64_t x = HALF_PI_Q30 * step / QUARTER_STEPS;
+                int64_t term = x;
+                int64_t sum = x;
+                for (int n = 1; n <= 7; n++)
+                {
+                    term = term * x / Q30_ONE;
+                    term = term * x / Q30_ONE;
+                    term = -term / ((2 * n) * (2 * n + 1));
+                    sum += term;
+                }
+
+                // Back to Q16.16, rounded; the sum is never negative here
+                values[step] = static_cast<int32_t>((sum + (int64_t(1) << 13)) / (int64_t(1) << 14));
+            }
+        }
+    };
+
+    const SineTable& sineTable()
+    {
+        static const SineTable table;
+        return table;
+    }
+}
+
+Fixed fixedSin(Fixed degrees)
+{
+    // Position in table steps (1024 per turn), still with 16 fraction bits
+    int64_t turns = int64_t(TURN_STEPS) << Fixed::FRACTION_BITS;
+    int64_t position = static_cast<int64_t>(degrees.getRaw()) * TURN_STEPS / 360 % turns;
+    if (position < 0)
+    {
+        position += turns;
+    }
+
+    int step = static_cast<int>(position >> Fixed::FRACTION_BITS);
+    int32_t fraction = static_cast<int32_t>(position & (Fixed::ONE - 1));
+    int quadrant = step / QUARTER_STEPS;
+    int index = step % QUARTER_STEPS;
+
+    // Second and fourth quadrants read the table backwards, the last two are negated
+    const int32_t* values = sineTable().values;
+    int32_t from = quadrant % 2 == 0 ? values[index] : values[QUARTER_STEPS - index];
+    int32_t to = quadrant % 2 == 0 ? values[index + 1] : values[QUARTER_STEPS - index - 1];
+    int32_t value = from + Fixed::multiply(to - from, fraction);
+    return Fixed::fromRaw(quadrant < 2 ? value : -value);
+}
+
+Fixed fixedCos(Fixed degrees)
+{
+    return fixedSin(degrees + Fixed(90));
+}
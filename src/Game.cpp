@@ -7,49 +7,110 @@
 #include "Item.h"
 #include "GameState.h"
 #include "EnhancedAIController.h" // Updated include for the new AI architecture
-#include "StateManager.h" // Include state definitions
+#include "World.h"
+#include "PlayerInput.h"
+#include "FixedTimestep.h"
+#include "Replay.h"
+#include "net/RollbackSession.h"
+#include "Profiler.h"
+#include "StressScene.h"
+#include "ParticleRenderer.h"
+#include "ParticleBudget.h"
 #include <vector>
 #include <string>
 #include <iostream>
 #include <cmath>
 #include <algorithm>
+#include <cstdlib>
+#include <ctime>
+#include <chrono>
 
 // Main game functions
 void InitGame();
 void UpdateGame();
-void DrawGame();
+void TickGame(const PlayerInput& input);
+void DrawGame(float alpha);
+void DrawStage();
+void DrawParticles();
+void DrawPlayers(float alpha);
+void DrawHud();
+void DrawScreens();
+void DrawDebugOverlay();
 void CleanupGame();
-
-// Use enums directly
-using CharacterState::IDLE;
-using CharacterState::RUNNING;
-using CharacterState::JUMPING;
-using CharacterState::FALLING;
-using CharacterState::ATTACKING;
-using CharacterState::SHIELDING;
-using CharacterState::DODGING;
-using CharacterState::HITSTUN;
-using CharacterState::DYING;
+void StartMatch();
+void SaveRecording();
+PlayerInput ReadPlayerInput();
+std::string ParseOption(int argc, char** argv, const std::string& name);
+bool InitNetplay(int argc, char** argv);
+bool InitStress(int argc, char** argv);
+void LogStressTiming(float frameSeconds);
 
 // Global game variables
 GameState gameState;
-std::vector<Character*> players;
-std::vector<Platform> platforms;
-std::vector<Vector2> spawnPoints;
-std::vector<Particle> particles;
+World world;
 Font gameFont;
 bool debugMode = false;
 
-// Create an instance of the enhanced AI controller
-std::unique_ptr<EnhancedAIController> enhancedAI;
+// The world's effects, drawn in one batched pass
+ParticleRenderer particleRenderer;
+
+// Shrinks the world's particle budget while frames run over the 60 Hz budget
+ParticleBudget particleBudget(PARTICLE_BUDGET_MIN, PARTICLE_BUDGET, 1000.0f / SIMULATION_TICK_RATE);
+
+// Difficulty for the enhanced AI controller
 float difficultyLevel = 0.8f; // Default to challenging (0.0 to 1.0)
 
+// Replay recording (--record <file>) and playback (--replay <file>)
+std::string recordPath;
+std::unique_ptr<ReplayRecorder> recorder;
+std::unique_ptr<ReplayPlayer> replayPlayer;
+
+// Two-machine play with rollback (--netplay <port> --peer <host:port> --player 1|2)
+UdpTransport transport;
+std::unique_ptr<RollbackSession> netSession;
+int netPlayer = -1; // Local slot, -1 when playing against the AI
+uint64_t netSeed = 0;
+int rollbackFrames = RollbackSession::DEFAULT_MAX_ROLLBACK_FRAMES;
+
+// Procedural scaling scene (--stress <characters> [--stress-platforms <n>]) with timing logged once a second
+bool stressMode = false;
+StressConfig stressConfig;
+double stressTickMs = 0.0;
+double stressTickMaxMs = 0.0;
+int stressTicks = 0;
+double stressFrameMs = 0.0;
+double stressFrameMaxMs = 0.0;
+int stressFrames = 0;
+
 // Main entry point
-int main()
+int main(int argc, char** argv)
 {
+    // Simulation runs at a fixed tick rate, independent of rendering
+    FixedTimestep timestep;
+
+    // Optional replay recording or playback
+    recordPath = ParseOption(argc, argv, "--record");
+    std::string replayPath = ParseOption(argc, argv, "--replay");
+    if (!replayPath.empty())
+    {
+        replayPlayer = std::make_unique<ReplayPlayer>();
+        if (!replayPlayer->load(replayPath))
+        {
+            std::cerr << "Could not load replay " << replayPath << std::endl;
+            return 1;
+        }
+    }
+
+    if (!InitNetplay(argc, argv) || !InitStress(argc, argv))
+    {
+        return 1;
+    }
+
+    PlayerInput pendingInput;
+
     // Initialize window
+    SetConfigFlags(FLAG_VSYNC_HINT);
     InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Super Smash Clone - Advanced AI Mode");
-    SetTargetFPS(60);
 
     // Initialize game
     InitGame();
@@ -57,14 +118,49 @@ int main()
     // Main game loop
     while (!WindowShouldClose())
     {
+        double frameStart = GetTime();
+
+        // Menu keys are handled once per rendered frame so presses are never dropped
         UpdateGame();
 
+        // Held buttons are merged over frames that run no tick, so quick taps still register
+        PlayerInput frameInput = ReadPlayerInput();
+        pendingInput.buttons |= frameInput.buttons;
+
+        int ticks = timestep.advance(GetFrameTime());
+        for (int i = 0; i < ticks; i++)
+        {
+            TickGame(pendingInput);
+            pendingInput = frameInput;
+        }
+
+        // Once a tick has seen them, start over so releases land on the next tick
+        if (ticks > 0)
+        {
+            pendingInput = PlayerInput();
+        }
+
         BeginDrawing();
         ClearBackground(RAYWHITE);
 
-        DrawGame();
+        // Blend positions by how far we are into the next tick
+        DrawGame(timestep.alpha());
+
+        // Work done this frame, before waiting for vsync
+        world.vfx.particles.setBudget(particleBudget.update(static_cast<float>((GetTime() - frameStart) * 1000.0)));
+
+        {
+            // Includes waiting for vsync
+            PROFILE_SCOPE("EndDrawing");
+            EndDrawing();
+        }
+
+        Profiler::get().endFrame();
 
-        EndDrawing();
+        if (stressMode)
+        {
+            LogStressTiming(GetFrameTime());
+        }
     }
 
     // Cleanup
@@ -78,74 +174,18 @@ void InitGame()
 {
     // Load font
     gameFont = GetFontDefault();
+    particleRenderer.load();
 
-    // Create platforms with appropriate types
-    // Main/bottom platform (SOLID - has full collision)
-    platforms.push_back(Platform(
-        SCREEN_WIDTH / 2 - 300, SCREEN_HEIGHT - 100,
-        600, 50,
-        DARKGRAY,
-        SOLID // Main platform is solid
-    ));
-
-    // Side platforms (PASSTHROUGH - only collide from top)
-    platforms.push_back(Platform(
-        SCREEN_WIDTH / 2 - 250, SCREEN_HEIGHT - 250,
-        150, 20,
-        GRAY,
-        PASSTHROUGH // Side platforms are passthrough
-    ));
-
-    platforms.push_back(Platform(
-        SCREEN_WIDTH / 2 + 100, SCREEN_HEIGHT - 250,
-        150, 20,
-        GRAY,
-        PASSTHROUGH // Side platforms are passthrough
-    ));
-
-    // Top platform (PASSTHROUGH)
-    platforms.push_back(Platform(
-        SCREEN_WIDTH / 2 - 75, SCREEN_HEIGHT - 400,
-        150, 20,
-        GRAY,
-        PASSTHROUGH // Top platform is passthrough
-    ));
-
-    // Create spawn points
-    spawnPoints.push_back({SCREEN_WIDTH / 2 - 200, SCREEN_HEIGHT - 200});
-    spawnPoints.push_back({SCREEN_WIDTH / 2 + 200, SCREEN_HEIGHT - 200});
-    spawnPoints.push_back({SCREEN_WIDTH / 2, SCREEN_HEIGHT - 200});
-    spawnPoints.push_back({SCREEN_WIDTH / 2, SCREEN_HEIGHT - 300});
-
-    // Create player and enemy
-    Character* player1 = new Character(
-        spawnPoints[0].x, spawnPoints[0].y,
-        50, 80,
-        5.0f,
-        RED,
-        "Player 1"
-    );
-
-    Character* enemy = new Character(
-        spawnPoints[1].x, spawnPoints[1].y,
-        50, 80,
-        5.0f,
-        BLUE,
-        "Enemy"
-    );
-
-    players.push_back(player1);
-    players.push_back(enemy);
-
-    // Initialize the AI controller
-    enhancedAI = std::make_unique<EnhancedAIController>();
-    enhancedAI->SetDifficulty(difficultyLevel);
+    // Build the stage and characters, with the AI driving the enemy
+    world.initDefaultStage();
+    world.setSeed(static_cast<uint64_t>(time(nullptr)));
+    world.enableAI(difficultyLevel);
 
     // Initialize game state
     gameState = GameState();
-    gameState.players = players;
-    gameState.platforms = platforms;
-    gameState.spawnPoints = spawnPoints;
+    gameState.players = world.players;
+    gameState.platforms = world.platforms;
+    gameState.spawnPoints = world.spawnPoints;
 
     // Start in title screen
     gameState.currentState = GameState::TITLE_SCREEN;
@@ -161,6 +201,8 @@ void InitGame()
 
 void UpdateGame()
 {
+    PROFILE_SCOPE("UpdateGame");
+
     // Process game state
     switch (gameState.currentState)
     {
@@ -168,32 +210,28 @@ void UpdateGame()
         // Title screen logic
         if (IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_SPACE))
         {
-            gameState.changeState(GameState::GAME_START);
+            StartMatch();
         }
 
     // Difficulty setting with clear indication
         if (IsKeyPressed(KEY_ONE))
         {
             difficultyLevel = 0.2f; // Easy
-            enhancedAI->SetDifficulty(difficultyLevel);
             DrawText("EASY MODE SELECTED", SCREEN_WIDTH/2 - 100, SCREEN_HEIGHT/2 + 50, 20, GREEN);
         }
         else if (IsKeyPressed(KEY_TWO))
         {
             difficultyLevel = 0.5f; // Medium
-            enhancedAI->SetDifficulty(difficultyLevel);
             DrawText("MEDIUM MODE SELECTED", SCREEN_WIDTH/2 - 100, SCREEN_HEIGHT/2 + 50, 20, YELLOW);
         }
         else if (IsKeyPressed(KEY_THREE))
         {
             difficultyLevel = 0.8f; // Hard
-            enhancedAI->SetDifficulty(difficultyLevel);
             DrawText("HARD MODE SELECTED", SCREEN_WIDTH/2 - 100, SCREEN_HEIGHT/2 + 50, 20, ORANGE);
         }
         else if (IsKeyPressed(KEY_FOUR))
         {
             difficultyLevel = 1.0f; // Expert
-            enhancedAI->SetDifficulty(difficultyLevel);
             DrawText("EXPERT MODE SELECTED", SCREEN_WIDTH/2 - 100, SCREEN_HEIGHT/2 + 50, 20, RED);
         }
         break;
@@ -210,16 +248,7 @@ void UpdateGame()
         // Stage selection logic
         if (IsKeyPressed(KEY_ENTER))
         {
-            gameState.changeState(GameState::GAME_START);
-        }
-        break;
-
-    case GameState::GAME_START:
-        // Game start countdown
-        gameState.stateTimer++;
-        if (gameState.stateTimer >= GAME_START_TIMER)
-        {
-            gameState.changeState(GameState::GAME_PLAYING);
+            StartMatch();
         }
         break;
 
@@ -237,255 +266,102 @@ void UpdateGame()
             debugMode = !debugMode;
         }
 
-    // Update players
-        for (auto& player : players)
-        {
-            player->update(platforms);
-        }
+        break;
 
-    // Check for character collisions for attacks
-        for (auto& attacker : players)
+    case GameState::GAME_PAUSED:
+        // Pause menu logic
+        if (IsKeyPressed(KEY_P) || IsKeyPressed(KEY_ESCAPE))
         {
-            // Skip players who are dying or exploding
-            if (attacker->stateManager.isDying || attacker->stateManager.isExploding) {
-                continue;
-            }
-            
-            if (attacker->stateManager.isAttacking)
-            {
-                for (auto& defender : players)
-                {
-                    if (attacker != defender)
-                    {
-                        attacker->checkHit(*defender);
-                    }
-                }
-            }
+            gameState.resumeGame();
         }
 
-    // Update particles
-        for (int i = 0; i < particles.size(); i++)
+        if (IsKeyPressed(KEY_R))
         {
-            if (!particles[i].update())
-            {
-                particles.erase(particles.begin() + i);
-                i--;
-            }
+            gameState.resetMatch();
         }
+        break;
 
-    // Player 1 controls
-        if (players[0]->stocks > 0 && !players[0]->stateManager.isDying)
+    case GameState::RESULTS_SCREEN:
+        // Results screen logic
+        if (IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_SPACE))
         {
-            // Movement
-            if (IsKeyDown(KEY_A)) players[0]->moveLeft();
-            if (IsKeyDown(KEY_D)) players[0]->moveRight();
-            if (IsKeyPressed(KEY_W)) players[0]->jump();
-
-            // Fast fall / platform drop-through
-            if (IsKeyDown(KEY_S))
-            {
-                if (players[0]->stateManager.state == IDLE || players[0]->stateManager.state == RUNNING)
-                {
-                    // On ground, attempt to drop through platform
-                    players[0]->dropThroughPlatform();
-                }
-                else if (players[0]->stateManager.state == FALLING)
-                {
-                    // In air, fast fall
-                    players[0]->fastFall();
-                }
-            }
+            gameState.resetMatch();
+            gameState.changeState(GameState::TITLE_SCREEN);
+        }
+        break;
 
-            // Attacks
-            if (IsKeyPressed(KEY_J))
-            {
-                // Basic attack - context sensitive
-                if (players[0]->stateManager.state == JUMPING || players[0]->stateManager.state == FALLING)
-                {
-                    players[0]->neutralAir();
-                }
-                else
-                {
-                    players[0]->jab();
-                }
-            }
+    default:
+        break;
+    }
+}
 
-            if (IsKeyPressed(KEY_K))
-            {
-                // Special attack - context sensitive
-                if (IsKeyDown(KEY_A))
-                {
-                    // Side special left
-                    players[0]->sideSpecial();
-                }
-                else if (IsKeyDown(KEY_D))
-                {
-                    // Side special right
-                    players[0]->sideSpecial();
-                }
-                else if (IsKeyDown(KEY_W))
-                {
-                    // Up special
-                    players[0]->upSpecial();
-                }
-                else if (IsKeyDown(KEY_S))
-                {
-                    // Down special
-                    players[0]->downSpecial();
-                }
-                else
-                {
-                    // Neutral special
-                    players[0]->neutralSpecial();
-                }
-            }
+void TickGame(const PlayerInput& input)
+{
+    PROFILE_SCOPE("TickGame");
 
-            // Smash attacks
-            if (IsKeyDown(KEY_L))
-            {
-                if (IsKeyDown(KEY_A))
-                {
-                    // Forward smash left
-                    players[0]->forwardSmash(20.0f);
-                }
-                else if (IsKeyDown(KEY_D))
-                {
-                    // Forward smash right
-                    players[0]->forwardSmash(20.0f);
-                }
-                else if (IsKeyDown(KEY_W))
-                {
-                    // Up smash
-                    players[0]->upSmash(20.0f);
-                }
-                else if (IsKeyDown(KEY_S))
-                {
-                    // Down smash
-                    players[0]->downSmash(20.0f);
-                }
-            }
+    // Keep exchanging inputs with the peer outside of gameplay so it never stalls on us
+    if (netSession && gameState.currentState != GameState::GAME_PLAYING)
+    {
+        netSession->poll();
+    }
 
-            // Shield/Dodge
-            if (IsKeyDown(KEY_I))
-            {
-                if (IsKeyPressed(KEY_A))
-                {
-                    players[0]->forwardDodge();
-                }
-                else if (IsKeyPressed(KEY_D))
-                {
-                    players[0]->backDodge();
-                }
-                else if (IsKeyPressed(KEY_S))
-                {
-                    players[0]->spotDodge();
-                }
-                else
-                {
-                    players[0]->shield();
-                }
-            }
-            else if (IsKeyReleased(KEY_I))
-            {
-                players[0]->releaseShield();
-            }
+    // Advance everything that counts in simulation frames
+    switch (gameState.currentState)
+    {
+    case GameState::GAME_START:
+        // Game start countdown
+        gameState.stateTimer++;
+        if (gameState.stateTimer >= GAME_START_TIMER)
+        {
+            gameState.changeState(GameState::GAME_PLAYING);
+        }
+        break;
 
-            // Grab
-            if (IsKeyPressed(KEY_U))
+    case GameState::GAME_PLAYING:
+        if (netSession)
+        {
+            // The session predicts the peer's input and rolls back when it turns out wrong;
+            // a match only ends on a frame both sides agree on
+            netSession->advance(input);
+            if (world.isMatchOver() && netSession->isSynchronized())
             {
-                players[0]->grab();
+                gameState.changeState(GameState::GAME_OVER);
             }
-
-            // Throws (when grabbing)
-            if (players[0]->stateManager.isGrabbing)
+        }
+        else
+        {
+            // Replays feed their recorded inputs through the same path as the keyboard
+            std::vector<PlayerInput> inputs = replayPlayer ? replayPlayer->next() : std::vector<PlayerInput>{input};
+            if (recorder)
             {
-                if (IsKeyPressed(KEY_J))
-                {
-                    players[0]->pummel();
-                }
-                else if (IsKeyPressed(KEY_A))
-                {
-                    players[0]->backThrow();
-                }
-                else if (IsKeyPressed(KEY_D))
-                {
-                    players[0]->forwardThrow();
-                }
-                else if (IsKeyPressed(KEY_W))
-                {
-                    players[0]->upThrow();
-                }
-                else if (IsKeyPressed(KEY_S))
-                {
-                    players[0]->downThrow();
-                }
+                recorder->record(inputs);
             }
 
-            // Aerial controls - more specific aerial attacks
-            if (players[0]->stateManager.state == JUMPING || players[0]->stateManager.state == FALLING)
+            std::chrono::steady_clock::time_point tickStart = std::chrono::steady_clock::now();
+            if (stressMode)
             {
-                if (IsKeyPressed(KEY_J))
-                {
-                    if (IsKeyDown(KEY_A))
-                    {
-                        players[0]->backAir();
-                    }
-                    else if (IsKeyDown(KEY_D))
-                    {
-                        players[0]->forwardAir();
-                    }
-                    else if (IsKeyDown(KEY_W))
-                    {
-                        players[0]->upAir();
-                    }
-                    else if (IsKeyDown(KEY_S))
-                    {
-                        players[0]->downAir();
-                    }
-                    else
-                    {
-                        players[0]->neutralAir();
-                    }
-                }
+                StressScene::drive(world, stressConfig);
             }
-        }
 
-    // Run the enhanced AI for the enemy
-        enhancedAI->Update(players, platforms);
+            world.step(inputs);
 
-    // Check for game end conditions
-        {
-            bool allButOneDead = true;
-            int aliveCount = 0;
-
-            for (auto& player : players)
+            if (stressMode)
             {
-                if (player->stocks > 0)
-                {
-                    aliveCount++;
-                }
+                std::chrono::duration<double, std::milli> tickTime = std::chrono::steady_clock::now() - tickStart;
+                stressTickMs += tickTime.count();
+                stressTickMaxMs = std::max(stressTickMaxMs, tickTime.count());
+                stressTicks++;
             }
 
-            if (aliveCount <= 1)
+            // Check for game end conditions
+            if (world.isMatchOver() || (replayPlayer && replayPlayer->isFinished()))
             {
+                SaveRecording();
                 gameState.changeState(GameState::GAME_OVER);
             }
         }
         break;
 
-    case GameState::GAME_PAUSED:
-        // Pause menu logic
-        if (IsKeyPressed(KEY_P) || IsKeyPressed(KEY_ESCAPE))
-        {
-            gameState.resumeGame();
-        }
-
-        if (IsKeyPressed(KEY_R))
-        {
-            gameState.resetMatch();
-        }
-        break;
-
     case GameState::GAME_OVER:
         // Game over logic
         gameState.stateTimer++;
@@ -495,45 +371,73 @@ void UpdateGame()
         }
         break;
 
-    case GameState::RESULTS_SCREEN:
-        // Results screen logic
-        if (IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_SPACE))
-        {
-            gameState.resetMatch();
-            gameState.changeState(GameState::TITLE_SCREEN);
-        }
-        break;
-
     default:
         break;
     }
 }
 
-void DrawGame()
+void DrawGame(float alpha)
 {
+    PROFILE_SCOPE("DrawGame");
+
+    // Draw from the current simulation state, one pass at a time
+    DrawStage();
+    DrawPlayers(alpha);
+    DrawParticles();
+    DrawHud();
+    DrawScreens();
+
+    // Draw debug info if enabled
+    if (debugMode)
+    {
+        DrawDebugOverlay();
+    }
+}
+
+void DrawStage()
+{
+    PROFILE_SCOPE("draw stage");
+
     // Draw background
     DrawRectangle(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, {135, 206, 235, 255}); // Sky blue
 
     // Draw platforms
-    for (auto& platform : platforms)
+    for (auto& platform : world.platforms)
     {
         platform.draw();
     }
+}
 
-    // Draw particles
-    for (auto& particle : particles)
-    {
-        particle.draw();
-    }
+void DrawParticles()
+{
+    PROFILE_SCOPE("draw particles");
+
+    // Particles, hit flashes and shockwaves in one batched pass, over the characters
+    particleRenderer.add(world.vfx);
+    particleRenderer.flush();
+}
+
+void DrawPlayers(float alpha)
+{
+    PROFILE_SCOPE("draw players");
 
     // Draw players
-    for (auto& player : players)
+    for (auto& player : world.players)
     {
-        player->draw();
+        player->draw(alpha);
     }
 
+    world.projectiles.draw(alpha);
+}
+
+void DrawHud()
+{
+    PROFILE_SCOPE("draw HUD");
+
+    std::vector<Character*>& players = world.players;
+
     // Draw HUD
-    for (int i = 0; i < players.size(); i++)
+    for (int i = 0; i < static_cast<int>(players.size()); i++)
     {
         Color playerColor = players[i]->color;
 
@@ -551,13 +455,20 @@ void DrawGame()
 
         // Damage percentage
         DrawText(
-            TextFormat("P%d: %.0f%%", i + 1, players[i]->damagePercent),
+            TextFormat("P%d: %.0f%%", i + 1, players[i]->getDamagePercent()),
             HUD_MARGIN + i * 200,
             HUD_MARGIN + STOCK_ICON_SIZE + 5,
             DAMAGE_FONT_SIZE,
             playerColor
         );
     }
+}
+
+void DrawScreens()
+{
+    PROFILE_SCOPE("draw screens");
+
+    std::vector<Character*>& players = world.players;
 
     // Draw state-specific screens
     switch (gameState.currentState)
@@ -611,7 +522,7 @@ void DrawGame()
 
             // Find the winner
             int winnerId = -1;
-            for (int i = 0; i < players.size(); i++)
+            for (int i = 0; i < static_cast<int>(players.size()); i++)
             {
                 if (players[i]->stocks > 0)
                 {
@@ -620,13 +531,15 @@ void DrawGame()
                 }
             }
 
-            if (winnerId == 0)
+            // In netplay this machine may be driving either slot
+            int localSlot = netPlayer >= 0 ? netPlayer : 0;
+            if (winnerId == localSlot)
             {
                 DrawText("YOU WIN!", SCREEN_WIDTH / 2 - 120, SCREEN_HEIGHT / 3, 50, GREEN);
             }
-            else if (winnerId == 1)
+            else if (winnerId >= 0)
             {
-                DrawText("AI WINS!", SCREEN_WIDTH / 2 - 120, SCREEN_HEIGHT / 3, 50, RED);
+                DrawText(netPlayer >= 0 ? "YOU LOSE!" : "AI WINS!", SCREEN_WIDTH / 2 - 120, SCREEN_HEIGHT / 3, 50, RED);
             }
             else
             {
@@ -640,113 +553,350 @@ void DrawGame()
             DrawRectangle(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, {0, 0, 0, 180});
             DrawText("RESULTS", SCREEN_WIDTH / 2 - 80, 100, 40, WHITE);
 
-            for (int i = 0; i < players.size(); i++)
+            for (int i = 0; i < static_cast<int>(players.size()); i++)
             {
                 Color playerColor = players[i]->color;
                 std::string displayName = (i == 0) ? "You" : "Enhanced AI";
                 DrawText(displayName.c_str(), 200, 200 + i * 80, 30, playerColor);
                 DrawText(TextFormat("Stocks: %d", players[i]->stocks), 400, 200 + i * 80, 30, WHITE);
-                DrawText(TextFormat("Damage: %.0f%%", players[i]->damagePercent), 600, 200 + i * 80, 30, WHITE);
+                DrawText(TextFormat("Damage: %.0f%%", players[i]->getDamagePercent()), 600, 200 + i * 80, 30, WHITE);
             }
 
             DrawText("Press ENTER to return to title screen", SCREEN_WIDTH / 2 - 220, SCREEN_HEIGHT - 100, 24, WHITE);
         }
         break;
     }
+}
 
-    // Draw debug info if enabled
-    if (debugMode)
+void DrawDebugOverlay()
+{
+    PROFILE_SCOPE("draw debug");
+
+    std::vector<Character*>& players = world.players;
+    ParticlePool& particles = world.vfx.particles;
+
+    // Draw blast zones
+    DrawRectangleLinesEx(
+        {
+            BLAST_ZONE_LEFT, BLAST_ZONE_TOP,
+            BLAST_ZONE_RIGHT - BLAST_ZONE_LEFT,
+            BLAST_ZONE_BOTTOM - BLAST_ZONE_TOP
+        },
+        2.0f,
+        {255, 0, 0, 128}
+    );
+
+    // Draw player positions and states
+    for (int i = 0; i < static_cast<int>(players.size()); i++)
     {
-        // Draw blast zones
-        DrawRectangleLinesEx(
-            {
-                BLAST_ZONE_LEFT, BLAST_ZONE_TOP,
-                BLAST_ZONE_RIGHT - BLAST_ZONE_LEFT,
-                BLAST_ZONE_BOTTOM - BLAST_ZONE_TOP
-            },
-            2.0f,
-            {255, 0, 0, 128}
+        Character* player = players[i];
+
+        // Position (varargs need plain floats, whatever Real is)
+        Vector2 position = player->physics.position;
+        Vector2 velocity = player->physics.velocity;
+        DrawText(
+            TextFormat("P%d Pos: (%.1f, %.1f)", i + 1, position.x, position.y),
+            10, SCREEN_HEIGHT - 120 + i * 20,
+            16,
+            WHITE
         );
 
-        // Draw player positions and states
-        for (int i = 0; i < players.size(); i++)
-        {
-            Character* player = players[i];
+        // Velocity
+        DrawText(
+            TextFormat("P%d Vel: (%.1f, %.1f)", i + 1, velocity.x, velocity.y),
+            220, SCREEN_HEIGHT - 120 + i * 20,
+            16,
+            WHITE
+        );
 
-            // Position
-            DrawText(
-                TextFormat("P%d Pos: (%.1f, %.1f)", i + 1, player->physics.position.x, player->physics.position.y),
-                10, SCREEN_HEIGHT - 120 + i * 20,
-                16,
-                WHITE
-            );
+        // State
+        const char* stateNames[] = {
+            "IDLE", "RUNNING", "JUMPING", "FALLING", "ATTACKING",
+            "SHIELDING", "DODGING", "HITSTUN", "DYING"
+        };
 
-            // Velocity
-            DrawText(
-                TextFormat("P%d Vel: (%.1f, %.1f)", i + 1, player->physics.velocity.x, player->physics.velocity.y),
-                220, SCREEN_HEIGHT - 120 + i * 20,
-                16,
-                WHITE
-            );
+        DrawText(
+            TextFormat("P%d State: %s", i + 1, stateNames[player->stateManager.state]),
+            430, SCREEN_HEIGHT - 120 + i * 20,
+            16,
+            WHITE
+        );
 
-            // State
-            const char* stateNames[] = {
-                "IDLE", "RUNNING", "JUMPING", "FALLING", "ATTACKING",
-                "SHIELDING", "DODGING", "HITSTUN", "DYING"
+        // AI state if applicable
+        EnhancedAIController* ai = world.getAI(i);
+        if (ai)
+        {
+            const char* aiStateNames[] = {
+                "NEUTRAL", "APPROACH", "ATTACK", "PRESSURE", "BAIT",
+                "DEFEND", "PUNISH", "RECOVER", "RETREAT", "EDGE_GUARD",
+                "LEDGE_TRAP", "COMBO"
             };
 
+            // Get current AI state from EnhancedAIController
+            EnhancedAIState::State currentAIState = ai->GetCurrentState();
+            float confidence = ai->GetCurrentConfidence();
+
             DrawText(
-                TextFormat("P%d State: %s", i + 1, stateNames[player->stateManager.state]),
-                430, SCREEN_HEIGHT - 120 + i * 20,
+                TextFormat("AI State: %s (%.2f)", aiStateNames[currentAIState], confidence),
+                630, SCREEN_HEIGHT - 120 + i * 20,
                 16,
-                WHITE
+                YELLOW
             );
-
-            // AI state if applicable
-            if (i == 1)
-            {
-                const char* aiStateNames[] = {
-                    "NEUTRAL", "APPROACH", "ATTACK", "PRESSURE", "BAIT",
-                    "DEFEND", "PUNISH", "RECOVER", "RETREAT", "EDGE_GUARD",
-                    "LEDGE_TRAP", "COMBO"
-                };
-
-                // Get current AI state from EnhancedAIController
-                EnhancedAIState::State currentAIState = enhancedAI->GetCurrentState();
-                float confidence = enhancedAI->GetCurrentConfidence();
-
-                DrawText(
-                    TextFormat("AI State: %s (%.2f)", aiStateNames[currentAIState], confidence),
-                    630, SCREEN_HEIGHT - 120 + i * 20,
-                    16,
-                    YELLOW
-                );
-            }
         }
+    }
+
+    // FPS info and difficulty
+    DrawText(
+        TextFormat("FPS: %d | Particles: %d/%d | Particle draw calls: %d (%d quads) | Difficulty: %.1f",
+                   GetFPS(), particles.size(), particles.getBudget(), particleRenderer.getStats().drawCalls,
+                   particleRenderer.getStats().quads, difficultyLevel),
+        10, SCREEN_HEIGHT - 40,
+        16,
+        WHITE
+    );
 
-        // FPS info and difficulty
+    if (netSession)
+    {
         DrawText(
-            TextFormat("FPS: %d | Particles: %d | Difficulty: %.1f",
-                       GetFPS(), (int)particles.size(), difficultyLevel),
-            10, SCREEN_HEIGHT - 40,
+            TextFormat("Net: frame %d | confirmed %d | rollback %d",
+                       netSession->getFrame(), netSession->getConfirmedFrame(), netSession->getLastRollbackFrames()),
+            10, SCREEN_HEIGHT - 60,
             16,
             WHITE
         );
     }
+
+    // Where the frame time went, per phase
+    Profiler::get().drawOverlay(SCREEN_WIDTH - 340, 70);
+}
+
+void StartMatch()
+{
+    // Every match starts from a freshly built world so it can be rebuilt from its replay header
+    if (stressMode)
+    {
+        StressScene::build(world, stressConfig);
+        gameState.players = world.players;
+        gameState.platforms = world.platforms;
+        gameState.spawnPoints = world.spawnPoints;
+        gameState.changeState(GameState::GAME_START);
+        return;
+    }
+
+    ReplayHeader header;
+    if (replayPlayer)
+    {
+        header = replayPlayer->getHeader();
+        replayPlayer->rewind();
+    }
+    else if (netPlayer >= 0)
+    {
+        // Both machines build the same world from the shared seed; no AI
+        header.seed = netSeed;
+        header.stageId = REPLAY_STAGE_DEFAULT;
+        header.stockCount = static_cast<uint8_t>(gameState.settings.stockCount);
+        header.aiEnabled = false;
+    }
+    else
+    {
+        header.seed = static_cast<uint64_t>(time(nullptr));
+        header.stageId = REPLAY_STAGE_DEFAULT;
+        header.stockCount = static_cast<uint8_t>(gameState.settings.stockCount);
+        header.aiEnabled = true;
+        header.aiDifficulty = difficultyLevel;
+    }
+
+    if (!world.initFromReplay(header))
+    {
+        std::cerr << "Replay uses unknown stage " << (int)header.stageId << std::endl;
+        return;
+    }
+    header.playerCount = static_cast<uint8_t>(world.players.size());
+
+    if (!recordPath.empty())
+    {
+        recorder = std::make_unique<ReplayRecorder>(header);
+    }
+
+    if (netPlayer >= 0)
+    {
+        netSession = std::make_unique<RollbackSession>(world, transport, netPlayer, rollbackFrames);
+    }
+
+    gameState.players = world.players;
+    gameState.platforms = world.platforms;
+    gameState.spawnPoints = world.spawnPoints;
+    gameState.changeState(GameState::GAME_START);
+}
+
+void SaveRecording()
+{
+    if (!recorder)
+    {
+        return;
+    }
+
+    if (!recorder->save(recordPath))
+    {
+        std::cerr << "Could not write replay " << recordPath << std::endl;
+    }
+    recorder.reset();
 }
 
 void CleanupGame()
 {
-    // Free allocated memory
-    for (auto& player : players)
+    // Keep whatever was recorded of an unfinished match
+    SaveRecording();
+
+    // Free the simulation and AI controller
+    netSession.reset();
+    transport.close();
+    world.clear();
+    world.disableAI();
+    particleRenderer.unload();
+}
+
+PlayerInput ReadPlayerInput()
+{
+    // Player 1 keyboard layout
+    PlayerInput input;
+
+    if (IsKeyDown(KEY_A)) input.buttons |= InputButton::LEFT;
+    if (IsKeyDown(KEY_D)) input.buttons |= InputButton::RIGHT;
+    if (IsKeyDown(KEY_W)) input.buttons |= InputButton::UP;
+    if (IsKeyDown(KEY_S)) input.buttons |= InputButton::DOWN;
+    if (IsKeyDown(KEY_J)) input.buttons |= InputButton::ATTACK;
+    if (IsKeyDown(KEY_K)) input.buttons |= InputButton::SPECIAL;
+    if (IsKeyDown(KEY_L)) input.buttons |= InputButton::SMASH;
+    if (IsKeyDown(KEY_I)) input.buttons |= InputButton::SHIELD;
+    if (IsKeyDown(KEY_U)) input.buttons |= InputButton::GRAB;
+
+    return input;
+}
+
+std::string ParseOption(int argc, char** argv, const std::string& name)
+{
+    // Value following a "--name value" pair, or empty if absent
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (name == argv[i])
+        {
+            return argv[i + 1];
+        }
+    }
+
+    return "";
+}
+
+bool InitNetplay(int argc, char** argv)
+{
+    std::string port = ParseOption(argc, argv, "--netplay");
+    if (port.empty())
     {
-        delete player;
+        return true;
     }
 
-    players.clear();
-    platforms.clear();
-    particles.clear();
+    // --peer host:port, defaulting to the next port on this machine for local testing
+    std::string peer = ParseOption(argc, argv, "--peer");
+    std::string peerHost = "127.0.0.1";
+    int peerPort = std::atoi(port.c_str()) + 1;
+    if (!peer.empty())
+    {
+        size_t colon = peer.rfind(':');
+        peerHost = peer.substr(0, colon);
+        if (colon != std::string::npos)
+        {
+            peerPort = std::atoi(peer.c_str() + colon + 1);
+        }
+    }
+
+    std::string player = ParseOption(argc, argv, "--player");
+    netPlayer = player == "2" ? 1 : 0;
+    netSeed = std::strtoull(ParseOption(argc, argv, "--seed").c_str(), nullptr, 10);
+
+    std::string frames = ParseOption(argc, argv, "--rollback-frames");
+    if (!frames.empty())
+    {
+        rollbackFrames = std::max(1, std::atoi(frames.c_str()));
+    }
+
+    if (!transport.open(static_cast<uint16_t>(std::atoi(port.c_str())), peerHost, static_cast<uint16_t>(peerPort)))
+    {
+        std::cerr << "Could not open netplay port " << port << " to " << peerHost << ":" << peerPort << std::endl;
+        return false;
+    }
+
+    // Built-in delay/loss emulation for testing over localhost
+    NetworkConditions conditions;
+    conditions.delayMs = std::atoi(ParseOption(argc, argv, "--net-delay").c_str());
+    conditions.jitterMs = std::atoi(ParseOption(argc, argv, "--net-jitter").c_str());
+    conditions.lossRate = std::atoi(ParseOption(argc, argv, "--net-loss").c_str()) / 100.0f;
+    transport.setConditions(conditions);
+
+    // Inputs are predicted and rewritten during netplay, so there is nothing faithful to record
+    if (!recordPath.empty() || replayPlayer)
+    {
+        std::cerr << "--record and --replay are ignored during netplay" << std::endl;
+        recordPath.clear();
+        replayPlayer.reset();
+    }
+
+    return true;
+}
+
+bool InitStress(int argc, char** argv)
+{
+    std::string characters = ParseOption(argc, argv, "--stress");
+    if (characters.empty())
+    {
+        return true;
+    }
+
+    stressConfig.characters = std::atoi(characters.c_str());
+    std::string platforms = ParseOption(argc, argv, "--stress-platforms");
+    if (!platforms.empty())
+    {
+        stressConfig.platforms = std::atoi(platforms.c_str());
+    }
+
+    if (stressConfig.characters < 2 || stressConfig.platforms < 1)
+    {
+        std::cerr << "--stress needs at least 2 characters and 1 platform" << std::endl;
+        return false;
+    }
+
+    // Every slot is AI-driven on a generated stage, which neither replays nor netplay can rebuild
+    if (netPlayer >= 0 || replayPlayer || !recordPath.empty())
+    {
+        std::cerr << "--stress cannot be combined with netplay, --record or --replay" << std::endl;
+        return false;
+    }
+
+    stressMode = true;
+    return true;
+}
+
+void LogStressTiming(float frameSeconds)
+{
+    stressFrameMs += frameSeconds * 1000.0;
+    stressFrameMaxMs = std::max(stressFrameMaxMs, frameSeconds * 1000.0);
+    stressFrames++;
+
+    // One line per second of wall time, covering only the ticks simulated in it
+    if (stressFrameMs < 1000.0)
+    {
+        return;
+    }
+
+    std::cout << "stress " << world.players.size() << " characters, " << world.platforms.size() << " platforms: ";
+    if (stressTicks > 0)
+    {
+        std::cout << "tick avg " << stressTickMs / stressTicks << " ms max " << stressTickMaxMs << " ms, ";
+    }
+    std::cout << "frame avg " << stressFrameMs / stressFrames << " ms max " << stressFrameMaxMs << " ms ("
+              << stressFrames << " fps)" << std::endl;
 
-    // Clear AI controller
-    enhancedAI.reset();
+    stressTickMs = stressTickMaxMs = 0.0;
+    stressFrameMs = stressFrameMaxMs = 0.0;
+    stressTicks = stressFrames = 0;
 }
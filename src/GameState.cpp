@@ -1,5 +1,6 @@
 #include "GameState.h"
 #include "ParticleSystem.h"
+#include "Random.h"
 #include <algorithm>
 
 // Constructor
@@ -79,7 +80,7 @@ void GameState::update() {
         }
 
         // Spawn items randomly
-        if (settings.itemsEnabled && GetRandomValue(0, 100) < settings.itemFrequency * 100 && GetFrameTime() * GetRandomValue(0, 1000) < 1) {
+        if (settings.itemsEnabled && gameplayRandom(0, 100) < settings.itemFrequency * 100 && SIMULATION_TICK_SECONDS * gameplayRandom(0, 1000) < 1) {
             spawnRandomItem();
         }
 
@@ -88,46 +89,6 @@ void GameState::update() {
     }
 }
 
-void GameState::draw() {
-    switch (currentState) {
-        case TITLE_SCREEN:
-            drawTitleScreen();
-            break;
-
-        case CHARACTER_SELECT:
-            drawCharacterSelect();
-            break;
-
-        case STAGE_SELECT:
-            drawStageSelect();
-            break;
-
-        case GAME_START:
-        case GAME_PLAYING:
-        case GAME_SUDDEN_DEATH:
-        case GAME_OVER:
-            drawGamePlaying();
-
-            // Draw HUD on top
-            drawHUD();
-            break;
-
-        case GAME_PAUSED:
-            drawGamePlaying();
-            drawGamePaused();
-            break;
-
-        case RESULTS_SCREEN:
-            drawResultsScreen();
-            break;
-    }
-
-    // Draw debug info if enabled
-    if (debugMode) {
-        drawDebugInfo();
-    }
-}
-
 void GameState::changeState(State newState) {
     currentState = newState;
     stateTimer = 0;
@@ -197,8 +158,6 @@ void GameState::resetMatch() {
         player->stateManager.isExploding = false;
         player->stateManager.isGrabbing = false;
         player->grabbedCharacter = nullptr;
-        player->explosionParticles.clear();
-        player->hitEffects.clear();
         player->resetAttackState();
         
         // Reset position to spawn point
@@ -209,11 +168,12 @@ void GameState::resetMatch() {
             } else {
                 player->physics.position = spawnPoints[0];
             }
+            player->physics.resetInterpolation();
         }
         
         // Reset physics
         player->physics.velocity = {0, 0};
-        player->stateManager.changeState(FALLING);
+        player->stateManager.changeState(CharacterState::FALLING);
     }
 
     // Clear items and effects
@@ -286,222 +246,6 @@ void GameState::updateItems() {
     items.clear(); // Just clear any existing items since we can't actually update them yet
 }
 
-void GameState::drawItems() {
-    // Item drawing removed - will be implemented in a future update
-}
-
-void GameState::drawTitleScreen() {
-    // Draw background
-    DrawRectangle(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, {0, 0, 0, 150});
-
-    // Draw title
-    DrawText("SUPER SMASH CLONE", SCREEN_WIDTH/2 - 180, SCREEN_HEIGHT/4, 40, WHITE);
-
-    // Draw menu options
-    const char* options[] = {
-        "START GAME",
-        "OPTIONS",
-        "CONTROLS",
-        "EXIT"
-    };
-
-    for (int i = 0; i < 4; i++) {
-        Color optionColor = (i == titleOptionSelected) ? RED : WHITE;
-        DrawText(options[i], SCREEN_WIDTH/2 - 80, SCREEN_HEIGHT/2 + i * 40, 24, optionColor);
-    }
-
-    // Draw controls info
-    DrawText("Press ENTER to select", SCREEN_WIDTH/2 - 110, SCREEN_HEIGHT - 100, 20, WHITE);
-    DrawText("Use UP/DOWN to navigate", SCREEN_WIDTH/2 - 130, SCREEN_HEIGHT - 70, 20, WHITE);
-}
-
-void GameState::drawCharacterSelect() {
-    // Draw background
-    DrawRectangle(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, {40, 40, 80, 255});
-
-    // Draw title
-    DrawText("CHARACTER SELECT", SCREEN_WIDTH/2 - 160, 50, 40, WHITE);
-
-    // Draw character slots for 4 players
-    for (int i = 0; i < 4; i++) {
-        // Character box
-        Rectangle charRect = {
-            static_cast<float>(200 + (i % 2) * 450),
-            static_cast<float>(150 + (i / 2) * 250),
-            200,
-            200
-        };
-
-        Color playerColor;
-        switch (i) {
-            case 0: playerColor = RED; break;
-            case 1: playerColor = BLUE; break;
-            case 2: playerColor = GREEN; break;
-            case 3: playerColor = YELLOW; break;
-            default: playerColor = WHITE;
-        }
-
-        DrawRectangleRec(charRect, playerColor);
-        DrawRectangleLinesEx(charRect, 3, WHITE);
-
-        // Player label
-        DrawText(TextFormat("P%d", i+1), charRect.x + 85, charRect.y + 80, 30, WHITE);
-
-        // Ready indicator for human players
-        if (i < 2) { // First two are human players
-            DrawText("READY!", charRect.x + 70, charRect.y + 140, 20, WHITE);
-        }
-    }
-
-    // Draw navigation prompt
-    DrawText("Press ENTER to continue", SCREEN_WIDTH/2 - 140, SCREEN_HEIGHT - 80, 24, WHITE);
-}
-
-void GameState::drawStageSelect() {
-    // Draw background
-    DrawRectangle(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, {40, 80, 40, 255});
-
-    // Draw title
-    DrawText("STAGE SELECT", SCREEN_WIDTH/2 - 120, 50, 40, WHITE);
-
-    // Draw stage options
-    const char* stageNames[] = {
-        "BATTLEFIELD",
-        "FINAL DESTINATION",
-        "DREAM LAND",
-        "POKEMON STADIUM",
-        "SMASHVILLE"
-    };
-
-    for (int i = 0; i < 5; i++) {
-        Rectangle stageRect = {
-            static_cast<float>(140 + (i % 3) * 350),
-            static_cast<float>(150 + (i / 3) * 220),
-            300,
-            200
-        };
-
-        Color stageColor = (i == stageSelectIndex) ? GREEN : DARKGRAY;
-        DrawRectangleRec(stageRect, stageColor);
-        DrawRectangleLinesEx(stageRect, 3, WHITE);
-
-        // Stage name
-        DrawText(stageNames[i], stageRect.x + 150 - MeasureText(stageNames[i], 24)/2,
-                stageRect.y + 85, 24, WHITE);
-    }
-
-    // Draw navigation prompt
-    DrawText("Press ENTER to start match", SCREEN_WIDTH/2 - 150, SCREEN_HEIGHT - 80, 24, WHITE);
-}
-
-void GameState::drawHUD() {
-    // Draw player stock icons and damage percentages
-    for (int i = 0; i < players.size(); i++) {
-        Color playerColor = players[i]->color;
-
-        // Stock icons
-        for (int s = 0; s < players[i]->stocks; s++) {
-            DrawRectangle(
-                HUD_MARGIN + s * (STOCK_ICON_SIZE + 5) + i * 200,
-                HUD_MARGIN,
-                STOCK_ICON_SIZE,
-                STOCK_ICON_SIZE,
-                playerColor
-            );
-        }
-
-        // Damage percentage
-        DrawText(
-            TextFormat("P%d: %.0f%%", i+1, players[i]->damagePercent),
-            HUD_MARGIN + i * 200,
-            HUD_MARGIN + STOCK_ICON_SIZE + 5,
-            DAMAGE_FONT_SIZE,
-            playerColor
-        );
-    }
-
-    // Draw match timer if time mode is enabled
-    if (settings.timeLimit > 0) {
-        int timeRemaining = settings.timeLimit - currentTime / 60;
-        DrawText(
-            TextFormat("%d:%02d", timeRemaining / 60, timeRemaining % 60),
-            SCREEN_WIDTH / 2 - 40,
-            HUD_MARGIN,
-            40,
-            WHITE
-        );
-    }
-
-    // Draw sudden death indicator
-    if (isSuddenDeath) {
-        DrawText("SUDDEN DEATH!", SCREEN_WIDTH/2 - 120, 70, 30, RED);
-    }
-}
-
-void GameState::drawGamePlaying() {
-    // Game objects are drawn by the main drawing function
-
-    // Draw additional game state info
-    if (currentState == GAME_START) {
-        DrawRectangle(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, {0, 0, 0, 100});
-        int countdown = (GAME_START_TIMER - stateTimer) / 60 + 1;
-        DrawText(TextFormat("%d", countdown), SCREEN_WIDTH/2 - 20, SCREEN_HEIGHT/2 - 50, 100, WHITE);
-    }
-
-    if (currentState == GAME_OVER) {
-        DrawRectangle(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, {0, 0, 0, 150});
-
-        // Find the winner
-        int winnerId = winnerIndex;
-
-        if (winnerId != -1) {
-            DrawText(TextFormat("PLAYER %d WINS!", winnerId + 1), SCREEN_WIDTH/2 - 150, SCREEN_HEIGHT/3, 40, WHITE);
-        } else {
-            DrawText("DRAW!", SCREEN_WIDTH/2 - 60, SCREEN_HEIGHT/3, 40, WHITE);
-        }
-    }
-}
-
-void GameState::drawGamePaused() {
-    DrawRectangle(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, {0, 0, 0, 150});
-    DrawText("PAUSED", SCREEN_WIDTH/2 - 80, SCREEN_HEIGHT/3, 50, WHITE);
-    DrawText("Press P to Resume", SCREEN_WIDTH/2 - 120, SCREEN_HEIGHT/2, 30, WHITE);
-    DrawText("Press R to Restart", SCREEN_WIDTH/2 - 120, SCREEN_HEIGHT/2 + 40, 30, WHITE);
-}
-
-void GameState::drawResultsScreen() {
-    DrawRectangle(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, {0, 0, 0, 180});
-    DrawText("RESULTS", SCREEN_WIDTH/2 - 80, 100, 40, WHITE);
-
-    for (int i = 0; i < results.size(); i++) {
-        Color playerColor = players[i]->color;
-        
-        // Change display names based on PvE
-        std::string displayName = (i == 0) ? "You" : "Enemy";
-        
-        DrawText(displayName.c_str(), 200, 200 + i*80, 30, playerColor);
-        DrawText(TextFormat("Stocks: %d", results[i].stocksRemaining), 400, 200 + i*80, 30, WHITE);
-
-        if (winnerIndex == i) {
-            if (i == 0) {
-                DrawText("VICTORY!", 600, 200 + i*80, 30, GREEN);
-            } else {
-                DrawText("DEFEATED YOU!", 600, 200 + i*80, 30, RED);
-            }
-        }
-    }
-
-    DrawText("Press ENTER to return to title screen", SCREEN_WIDTH/2 - 220, SCREEN_HEIGHT - 100, 24, WHITE);
-}
-
-void GameState::drawDebugInfo() {
-    DrawRectangle(10, 10, 300, 100, {0, 0, 0, 128});
-    DrawText(TextFormat("State: %d | Timer: %d", currentState, stateTimer), 20, 20, 16, WHITE);
-    DrawText(TextFormat("FPS: %d | Players: %d", GetFPS(), (int)players.size()), 20, 40, 16, WHITE);
-    DrawText(TextFormat("Items: %d | Particles: %d", (int)items.size(), (int)particles.size()), 20, 60, 16, WHITE);
-    DrawText(debugText.c_str(), 20, 80, 16, YELLOW);
-}
-
 void GameState::toggleDebugMode() {
     debugMode = !debugMode;
 }
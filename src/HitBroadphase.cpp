@@ -0,0 +1,90 @@
+#include "HitBroadphase.h"
+#include <algorithm>
+
+void HitBroadphase::clear()
+{
+    boxes.clear();
+    pairs.clear();
+}
+
+void HitBroadphase::addHitbox(int owner, int attack, Rect rect)
+{
+    add(owner, attack, false, rect);
+}
+
+void HitBroadphase::addProjectile(int owner, int projectile, Rect rect)
+{
+    add(owner, projectile, true, rect);
+}
+
+void HitBroadphase::addHurtbox(int owner, Rect rect)
+{
+    add(owner, -1, false, rect);
+}
+
+void HitBroadphase::add(int owner, int attack, bool projectile, Rect rect)
+{
+    boxes.push_back({rect.x, rect.x + rect.width, rect.y, rect.y + rect.height, owner, attack, projectile});
+}
+
+const std::vector<HitCandidate>& HitBroadphase::findPairs()
+{
+    pairs.clear();
+    openHitboxes.clear();
+    openHurtboxes.clear();
+
+    std::sort(boxes.begin(), boxes.end(), [](const Box& a, const Box& b) { return a.minX < b.minX; });
+
+    for (int i = 0; i < static_cast<int>(boxes.size()); i++)
+    {
+        const Box& box = boxes[i];
+
+        // Boxes ending at or before this one starts overlap nothing from here on
+        for (std::vector<int>* open : {&openHitboxes, &openHurtboxes})
+        {
+            for (size_t k = 0; k < open->size();)
+            {
+                if (boxes[(*open)[k]].maxX <= box.minX)
+                {
+                    (*open)[k] = open->back();
+                    open->pop_back();
+                }
+                else
+                {
+                    k++;
+                }
+            }
+        }
+
+        bool isHitbox = box.attack >= 0;
+        sweep(box, isHitbox ? openHurtboxes : openHitboxes, isHitbox);
+        (isHitbox ? openHitboxes : openHurtboxes).push_back(i);
+    }
+
+    // The sweep finds pairs in x order; hits resolve in slot order
+    std::sort(pairs.begin(), pairs.end(), [](const HitCandidate& a, const HitCandidate& b)
+    {
+        if (a.attacker != b.attacker) return a.attacker < b.attacker;
+        if (a.defender != b.defender) return a.defender < b.defender;
+        if (a.projectile != b.projectile) return b.projectile;
+        return a.attack < b.attack;
+    });
+    return pairs;
+}
+
+void HitBroadphase::sweep(const Box& box, const std::vector<int>& open, bool boxIsHitbox)
+{
+    for (int index : open)
+    {
+        const Box& other = boxes[index];
+        if (other.owner == box.owner || other.minX >= box.maxX ||
+            other.minY >= box.maxY || other.maxY <= box.minY)
+        {
+            continue;
+        }
+
+        const Box& hitbox = boxIsHitbox ? box : other;
+        const Box& hurtbox = boxIsHitbox ? other : box;
+        pairs.push_back({hitbox.owner, hitbox.attack, hurtbox.owner, hitbox.projectile});
+    }
+}
@@ -0,0 +1,34 @@
+#include "HitEvent.h"
+#include "Collision.h"
+#include "ProjectilePool.h"
+#include "character/Character.h"
+
+void detectHits(const std::vector<Character*>& players, const ProjectilePool& projectiles,
+                const std::vector<HitCandidate>& candidates, size_t begin, size_t end,
+                std::vector<HitEvent>& out)
+{
+    for (size_t i = begin; i < end; i++)
+    {
+        const HitCandidate& candidate = candidates[i];
+        Rect hitbox;
+        AttackBox::HitboxType type;
+        if (candidate.projectile)
+        {
+            hitbox = projectiles.rect(candidate.attack);
+            type = AttackBox::PROJECTILE;
+        }
+        else
+        {
+            const AttackBox& attack = players[candidate.attacker]->attacks[candidate.attack];
+            hitbox = attack.rect;
+            type = attack.type;
+        }
+
+        Rect hurtbox = players[candidate.defender]->getHurtbox();
+        if (rectsOverlap(hitbox, hurtbox))
+        {
+            out.push_back({candidate.attacker, candidate.defender, candidate.attack, type,
+                           hitPoint(hitbox, hurtbox)});
+        }
+    }
+}
@@ -0,0 +1,151 @@
+#include "MovingPlatforms.h"
+#include "Snapshot.h"
+#include "StateHash.h"
+#include <algorithm>
+#include <cmath>
+
+void MovingPlatforms::add(int index, const std::vector<Platform>& platforms, Vector2 end, float speed, bool loop)
+{
+    const Rectangle& rect = platforms[index].rect;
+    float distanceX = end.x - rect.x;
+    float distanceY = end.y - rect.y;
+    float length = std::sqrt(distanceX * distanceX + distanceY * distanceY);
+
+    platform.push_back(index);
+    startX.push_back(rect.x);
+    startY.push_back(rect.y);
+    pathX.push_back(distanceX);
+    pathY.push_back(distanceY);
+    looping.push_back(loop ? 1 : 0);
+
+    progress.push_back(0.0f);
+    rate.push_back(length > 0.0f ? Real(speed) / Real(length) : Real(0.0f));
+    positionX.push_back(rect.x);
+    positionY.push_back(rect.y);
+    motionX.push_back(0.0f);
+    motionY.push_back(0.0f);
+}
+
+void MovingPlatforms::clear()
+{
+    platform.clear();
+    startX.clear();
+    startY.clear();
+    pathX.clear();
+    pathY.clear();
+    looping.clear();
+    progress.clear();
+    rate.clear();
+    positionX.clear();
+    positionY.clear();
+    motionX.clear();
+    motionY.clear();
+}
+
+Rectangle MovingPlatforms::pathBounds(int i, const std::vector<Platform>& platforms) const
+{
+    const Rectangle& rect = platforms[platform[i]].rect;
+    float fromX = startX[i];
+    float fromY = startY[i];
+    float toX = startX[i] + pathX[i];
+    float toY = startY[i] + pathY[i];
+    return {
+        std::min(fromX, toX),
+        std::min(fromY, toY),
+        std::fabs(toX - fromX) + rect.width,
+        std::fabs(toY - fromY) + rect.height
+    };
+}
+
+void MovingPlatforms::update(std::vector<Platform>& platforms)
+{
+    const Real zero = 0.0f;
+    const Real one = 1.0f;
+    int count = size();
+
+    // Progress and position of every platform first: a straight loop over the arrays
+    for (int i = 0; i < count; i++)
+    {
+        Real next = progress[i] + rate[i];
+        if (next >= one)
+        {
+            next = one;
+            rate[i] = looping[i] ? -rate[i] : zero;
+        }
+        else if (next <= zero)
+        {
+            next = zero;
+            rate[i] = -rate[i];
+        }
+        progress[i] = next;
+
+        Real x = startX[i] + pathX[i] * next;
+        Real y = startY[i] + pathY[i] * next;
+        motionX[i] = x - positionX[i];
+        motionY[i] = y - positionY[i];
+        positionX[i] = x;
+        positionY[i] = y;
+    }
+
+    apply(platforms);
+}
+
+void MovingPlatforms::apply(std::vector<Platform>& platforms) const
+{
+    for (int i = 0; i < size(); i++)
+    {
+        Platform& moving = platforms[platform[i]];
+        moving.rect.x = positionX[i];
+        moving.rect.y = positionY[i];
+        moving.motion = {motionX[i], motionY[i]};
+    }
+}
+
+void MovingPlatforms::save(SnapshotWriter& writer) const
+{
+    int count = size();
+    writer.write(static_cast<uint32_t>(count));
+    writer.writeSpan(progress.data(), count);
+    writer.writeSpan(rate.data(), count);
+    writer.writeSpan(positionX.data(), count);
+    writer.writeSpan(positionY.data(), count);
+    writer.writeSpan(motionX.data(), count);
+    writer.writeSpan(motionY.data(), count);
+}
+
+bool MovingPlatforms::restore(SnapshotReader& reader, std::vector<Platform>& platforms)
+{
+    // The stage decides which platforms move, so a snapshot of another stage never fits
+    uint32_t saved;
+    if (!reader.read(saved) || saved != static_cast<uint32_t>(size()))
+    {
+        return false;
+    }
+
+    int count = size();
+    reader.readSpan(progress.data(), count);
+    reader.readSpan(rate.data(), count);
+    reader.readSpan(positionX.data(), count);
+    reader.readSpan(positionY.data(), count);
+    reader.readSpan(motionX.data(), count);
+    reader.readSpan(motionY.data(), count);
+    if (reader.hasFailed())
+    {
+        return false;
+    }
+
+    apply(platforms);
+    return true;
+}
+
+void MovingPlatforms::hash(StateHasher& hasher) const
+{
+    hasher.add(size());
+    for (int i = 0; i < size(); i++)
+    {
+        hasher.add(progress[i]);
+        hasher.add(rate[i]);
+        hasher.add(positionX[i]);
+        hasher.add(positionY[i]);
+    }
+}
@@ -26,13 +26,4 @@ bool Particle::update() {
 
     // Return true if particle is still alive
     return currentLife < lifespan;
-}
-
-void Particle::draw() {
-    // Calculate alpha based on remaining life
-    unsigned char alpha = (unsigned char)(255 * (1.0f - (float)currentLife / lifespan));
-    Color drawColor = {color.r, color.g, color.b, alpha};
-
-    // Draw particle as circle
-    DrawCircleV(position, size, drawColor);
 }
\ No newline at end of file
@@ -0,0 +1,37 @@
+#include "ParticleBudget.h"
+
+namespace {
+    // Weight of the newest frame in the smoothed time
+    const float SMOOTHING = 0.1f;
+
+    // Grow only while this far under the target, so the budget does not oscillate around it
+    const float GROW_THRESHOLD = 0.8f;
+
+    // Fraction of the full budget recovered per frame under the threshold
+    const int GROW_STEPS = 120;
+}
+
+ParticleBudget::ParticleBudget(int minBudget, int maxBudget, float targetFrameMs)
+    : minimum(minBudget), maximum(maxBudget), budget(maxBudget), targetMs(targetFrameMs), smoothedMs(0.0f) {
+}
+
+int ParticleBudget::update(float frameMs) {
+    smoothedMs = smoothedMs == 0.0f ? frameMs : smoothedMs + (frameMs - smoothedMs) * SMOOTHING;
+
+    if (smoothedMs > targetMs) {
+        budget -= budget / 10;
+        if (budget < minimum) {
+            budget = minimum;
+        }
+    } else if (smoothedMs < targetMs * GROW_THRESHOLD && budget < maximum) {
+        int step = maximum / GROW_STEPS > 0 ? maximum / GROW_STEPS : 1;
+        budget = budget + step < maximum ? budget + step : maximum;
+    }
+
+    return budget;
+}
+
+void ParticleBudget::reset() {
+    budget = maximum;
+    smoothedMs = 0.0f;
+}
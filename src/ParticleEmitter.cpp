@@ -0,0 +1,339 @@
+#include "ParticleEmitter.h"
+#include "ParticlePool.h"
+#include "Cosmetics.h"
+#include "Random.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Particles generated per batch of random values; bounds the stack buffer
+    const int CHUNK = 256;
+
+    // Random words each particle consumes: angle, speed, size, lifespan,
+    // palette entry and one per jittered color channel
+    const int WORDS_PER_PARTICLE = 8;
+
+    // One full turn of sine; cosine reads a quarter turn ahead
+    const int SINE_BITS = 10;
+    const int SINE_SIZE = 1 << SINE_BITS;
+    const int QUARTER_TURN = SINE_SIZE / 4;
+
+    struct SineTable {
+        float values[SINE_SIZE];
+
+        SineTable() {
+            for (int i = 0; i < SINE_SIZE; i++) {
+                values[i] = sinf(i * (2.0f * PI / SINE_SIZE));
+            }
+        }
+    };
+
+    const float* sineTable() {
+        static const SineTable table;
+        return table.values;
+    }
+
+    // Angles are 32-bit fractions of a turn, so wrapping is free
+    uint32_t degreesToPhase(float degrees) {
+        double turns = degrees / 360.0;
+        turns -= floor(turns);
+        return static_cast<uint32_t>(static_cast<uint64_t>(turns * 4294967296.0));
+    }
+
+    inline float unitFloat(uint32_t bits) {
+        return (bits >> 8) * (1.0f / 16777216.0f);
+    }
+
+    // Multiply-shift onto [0, span) without a division, as Random::range does
+    inline int scaled(uint32_t bits, uint32_t span) {
+        return static_cast<int>((static_cast<uint64_t>(bits) * span) >> 32);
+    }
+
+    inline unsigned char jitterChannel(unsigned char value, uint32_t bits, int jitter) {
+        int shifted = value + scaled(bits, 2 * jitter + 1) - jitter;
+        return static_cast<unsigned char>(shifted < 0 ? 0 : (shifted > 255 ? 255 : shifted));
+    }
+
+    inline unsigned char offsetChannel(unsigned char value, int offset) {
+        int shifted = value + offset;
+        return static_cast<unsigned char>(shifted < 0 ? 0 : (shifted > 255 ? 255 : shifted));
+    }
+
+    const Color FIRE_PALETTE[] = {RED, ORANGE, YELLOW, WHITE};
+
+    // Layers of the massive explosion
+    const Color SMOKE_PALETTE[] = {{180, 180, 180, 255}, {200, 200, 200, 255}, {220, 220, 220, 255}, {240, 240, 240, 255}};
+    const Color SPARK_PALETTE[] = {YELLOW, WHITE, {255, 200, 50, 255}};
+    const Color DEBRIS_PALETTE[] = {DARKGRAY, BLACK, {50, 50, 50, 255}};
+
+    // Variants baked per template; enough that repeats are not noticeable once rotated
+    const int TEMPLATE_VARIANTS = 8;
+}
+
+int ParticleEmitter::emit(ParticlePool& pool, const EmitterDesc& desc, Vector2 position, Color baseColor, float heading) {
+    if (!cosmeticsEnabled() || desc.count <= 0) {
+        return 0;
+    }
+
+    ParticleSpan span = pool.claim(desc.count, desc.priority);
+    if (span.count == 0) {
+        return 0;
+    }
+
+    const float* sine = sineTable();
+    Random& random = cosmeticStream();
+
+    uint32_t startPhase = degreesToPhase(desc.direction + heading - desc.spread * 0.5f);
+    uint64_t spreadPhase = desc.spread >= 360.0f ? (1ULL << 32)
+                         : static_cast<uint64_t>((desc.spread > 0.0f ? desc.spread : 0.0f) / 360.0 * 4294967296.0);
+    float speedRange = desc.speedMax - desc.speedMin;
+    float sizeRange = desc.sizeMax - desc.sizeMin;
+    uint32_t lifespanSpan = static_cast<uint32_t>(desc.lifespanMax - desc.lifespanMin + 1);
+    uint32_t colorChoices = static_cast<uint32_t>(desc.paletteSize + (desc.useBaseColor ? 1 : 0));
+    uint8_t blend = static_cast<uint8_t>(desc.blend);
+
+    uint32_t bits[CHUNK * WORDS_PER_PARTICLE];
+    for (int first = 0; first < span.count; first += CHUNK) {
+        int n = span.count - first < CHUNK ? span.count - first : CHUNK;
+        random.fill(bits, n * WORDS_PER_PARTICLE);
+
+        const uint32_t* angleBits = bits;
+        const uint32_t* speedBits = bits + n;
+        const uint32_t* sizeBits = bits + 2 * n;
+        const uint32_t* lifespanBits = bits + 3 * n;
+        const uint32_t* colorBits = bits + 4 * n;
+        const uint32_t* jitterBits = bits + 5 * n;
+
+        // One field at a time, so each loop is a straight run over one array
+        float* posX = span.posX + first;
+        float* posY = span.posY + first;
+        float* velX = span.velX + first;
+        float* velY = span.velY + first;
+        for (int i = 0; i < n; i++) {
+            uint32_t phase = startPhase + static_cast<uint32_t>((angleBits[i] * spreadPhase) >> 32);
+            int index = phase >> (32 - SINE_BITS);
+            float speed = desc.speedMin + unitFloat(speedBits[i]) * speedRange;
+            posX[i] = position.x;
+            posY[i] = position.y;
+            velX[i] = sine[(index + QUARTER_TURN) & (SINE_SIZE - 1)] * speed;
+            velY[i] = sine[index] * speed;
+        }
+
+        float* size = span.size + first;
+        int* life = span.life + first;
+        int* lifespan = span.lifespan + first;
+        uint8_t* blendMode = span.blend + first;
+        for (int i = 0; i < n; i++) {
+            size[i] = desc.sizeMin + unitFloat(sizeBits[i]) * sizeRange;
+            life[i] = 0;
+            lifespan[i] = desc.lifespanMin + scaled(lifespanBits[i], lifespanSpan);
+            blendMode[i] = blend;
+        }
+
+        Color* color = span.color + first;
+        for (int i = 0; i < n; i++) {
+            int choice = colorChoices ? scaled(colorBits[i], colorChoices) : 0;
+            Color picked = choice < desc.paletteSize ? desc.palette[choice] : (desc.useBaseColor ? baseColor : WHITE);
+            if (desc.colorJitter > 0) {
+                picked.r = jitterChannel(picked.r, jitterBits[3 * i], desc.colorJitter);
+                picked.g = jitterChannel(picked.g, jitterBits[3 * i + 1], desc.colorJitter);
+                picked.b = jitterChannel(picked.b, jitterBits[3 * i + 2], desc.colorJitter);
+            }
+            color[i] = picked;
+        }
+    }
+
+    return span.count;
+}
+
+BurstTemplate::BurstTemplate(std::initializer_list<EmitterDesc> layerDescs, int variants, uint64_t seed)
+    : perVariant(0), variantCount(variants > 0 ? variants : 1) {
+    for (const EmitterDesc& desc : layerDescs) {
+        Layer layer = {desc, perVariant};
+        layer.desc.count = desc.count > 0 ? desc.count : 0;
+        layers.push_back(layer);
+        perVariant += layer.desc.count;
+    }
+
+    int total = perVariant * variantCount;
+    velX.resize(total);
+    velY.resize(total);
+    radius.resize(total);
+    lifespan.resize(total);
+    paletteIndex.resize(total);
+    jitter.resize(total);
+
+    // Baked once with its own generator, so templates never touch a match's streams
+    Random random(seed);
+    for (int v = 0; v < variantCount; v++) {
+        for (const Layer& layer : layers) {
+            const EmitterDesc& desc = layer.desc;
+            int choices = desc.paletteSize + (desc.useBaseColor ? 1 : 0);
+            int first = v * perVariant + layer.offset;
+            for (int k = first; k < first + desc.count; k++) {
+                float angle = random.unit() * 2.0f * PI;
+                float speed = desc.speedMin + random.unit() * (desc.speedMax - desc.speedMin);
+                velX[k] = cosf(angle) * speed;
+                velY[k] = sinf(angle) * speed;
+                radius[k] = desc.sizeMin + random.unit() * (desc.sizeMax - desc.sizeMin);
+                lifespan[k] = random.range(desc.lifespanMin, desc.lifespanMax);
+                paletteIndex[k] = static_cast<uint8_t>(choices > 0 ? random.range(0, choices - 1) : desc.paletteSize);
+
+                int amount = desc.colorJitter < 127 ? desc.colorJitter : 127;
+                jitter[k].r = static_cast<int8_t>(amount > 0 ? random.range(-amount, amount) : 0);
+                jitter[k].g = static_cast<int8_t>(amount > 0 ? random.range(-amount, amount) : 0);
+                jitter[k].b = static_cast<int8_t>(amount > 0 ? random.range(-amount, amount) : 0);
+            }
+        }
+    }
+}
+
+int BurstTemplate::spawn(ParticlePool& pool, Vector2 position, Color baseColor) const {
+    if (!cosmeticsEnabled() || perVariant == 0) {
+        return 0;
+    }
+
+    // One draw picks the variant, another the rotation, whose lowest bit also picks mirroring
+    uint32_t bits[2];
+    cosmeticStream().fill(bits, 2);
+    int variant = scaled(bits[0], static_cast<uint32_t>(variantCount));
+    float mirror = (bits[1] & 1) ? -1.0f : 1.0f;
+    const float* sine = sineTable();
+    int index = bits[1] >> (32 - SINE_BITS);
+    float cosine = sine[(index + QUARTER_TURN) & (SINE_SIZE - 1)];
+    float sineValue = sine[index];
+
+    int spawned = 0;
+    for (const Layer& layer : layers) {
+        const EmitterDesc& desc = layer.desc;
+        ParticleSpan span = pool.claim(desc.count, desc.priority);
+        int first = variant * perVariant + layer.offset;
+        int n = span.count;
+
+        std::copy(radius.begin() + first, radius.begin() + first + n, span.size);
+        std::copy(lifespan.begin() + first, lifespan.begin() + first + n, span.lifespan);
+        std::fill(span.life, span.life + n, 0);
+        std::fill(span.blend, span.blend + n, static_cast<uint8_t>(desc.blend));
+        std::fill(span.posX, span.posX + n, position.x);
+        std::fill(span.posY, span.posY + n, position.y);
+
+        const float* fromX = velX.data() + first;
+        const float* fromY = velY.data() + first;
+        for (int i = 0; i < n; i++) {
+            float y = fromY[i] * mirror;
+            span.velX[i] = fromX[i] * cosine - y * sineValue;
+            span.velY[i] = fromX[i] * sineValue + y * cosine;
+        }
+
+        Color fallback = desc.useBaseColor ? baseColor : WHITE;
+        for (int i = 0; i < n; i++) {
+            int choice = paletteIndex[first + i];
+            Color picked = choice < desc.paletteSize ? desc.palette[choice] : fallback;
+            const ColorOffset& offset = jitter[first + i];
+            picked.r = offsetChannel(picked.r, offset.r);
+            picked.g = offsetChannel(picked.g, offset.g);
+            picked.b = offsetChannel(picked.b, offset.b);
+            span.color[i] = picked;
+        }
+
+        spawned += n;
+    }
+    return spawned;
+}
+
+namespace Emitters {
+    const EmitterDesc EXPLOSION_BURST = {
+        150,
+        5.0f, 15.0f,
+        3.0f, 12.0f,
+        30, 90,
+        0.0f, 360.0f,
+        FIRE_PALETTE, 4, true, 0,
+        BLEND_ADDITIVE, PRIORITY_EFFECT
+    };
+
+    const EmitterDesc EXPLOSION_TRAIL = {
+        5,
+        3.0f, 10.0f,
+        2.0f, 8.0f,
+        20, 60,
+        0.0f, 360.0f,
+        FIRE_PALETTE, 4, false, 0,
+        BLEND_ADDITIVE, PRIORITY_DEBRIS
+    };
+
+    const Color SPLASH_COLOR = {228, 228, 243, 255};
+
+    const EmitterDesc SPLASH = {
+        12,
+        2.0f, 6.0f,
+        2.0f, 6.0f,
+        20, 40,
+        0.0f, 360.0f,
+        &SPLASH_COLOR, 1, false, 27,
+        BLEND_ALPHA, PRIORITY_EFFECT
+    };
+
+    const EmitterDesc BLAST = {
+        50,
+        5.0f, 12.0f,
+        4.0f, 10.0f,
+        30, 60,
+        0.0f, 360.0f,
+        nullptr, 0, true, 20,
+        BLEND_ALPHA, PRIORITY_EFFECT
+    };
+
+    const EmitterDesc EXPLOSION = {
+        50,
+        2.0f, 8.0f,
+        2.0f, 6.0f,
+        15, 45,
+        0.0f, 360.0f,
+        nullptr, 0, true, 20,
+        BLEND_ALPHA, PRIORITY_EFFECT
+    };
+
+    const EmitterDesc HIT = {
+        10,
+        3.0f, 8.0f,
+        2.0f, 5.0f,
+        10, 25,
+        0.0f, 60.0f,
+        nullptr, 0, true, 0,
+        BLEND_ALPHA, PRIORITY_GAMEPLAY
+    };
+}
+
+namespace BurstTemplates {
+    const BurstTemplate& explosion() {
+        static const BurstTemplate burst({Emitters::EXPLOSION_BURST}, TEMPLATE_VARIANTS, 0xE7910510ULL);
+        return burst;
+    }
+
+    const BurstTemplate& massiveExplosion() {
+        // The base color core and the fire core go on top, so smoke is added first
+        static const EmitterDesc smoke = {
+            30, 8.0f, 20.0f, 5.0f, 15.0f, 40, 100, 0.0f, 360.0f,
+            SMOKE_PALETTE, 4, false, 0, BLEND_ALPHA, PRIORITY_EFFECT
+        };
+        static const EmitterDesc baseCore = {
+            30, 8.0f, 20.0f, 5.0f, 15.0f, 40, 100, 0.0f, 360.0f,
+            nullptr, 0, true, 20, BLEND_ALPHA, PRIORITY_EFFECT
+        };
+        static const EmitterDesc fireCore = {
+            40, 8.0f, 20.0f, 5.0f, 15.0f, 40, 100, 0.0f, 360.0f,
+            FIRE_PALETTE, 3, false, 0, BLEND_ADDITIVE, PRIORITY_EFFECT
+        };
+        static const EmitterDesc sparks = {
+            25, 15.0f, 30.0f, 1.0f, 3.0f, 10, 30, 0.0f, 360.0f,
+            SPARK_PALETTE, 3, false, 0, BLEND_ADDITIVE, PRIORITY_EFFECT
+        };
+        static const EmitterDesc debris = {
+            20, 5.0f, 12.0f, 3.0f, 8.0f, 30, 70, 0.0f, 360.0f,
+            DEBRIS_PALETTE, 3, true, 0, BLEND_ALPHA, PRIORITY_DEBRIS
+        };
+        static const BurstTemplate burst({smoke, baseCore, fireCore, sparks, debris}, TEMPLATE_VARIANTS, 0x3A551FEULL);
+        return burst;
+    }
+}
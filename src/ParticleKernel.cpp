@@ -0,0 +1,191 @@
+#include "ParticleKernel.h"
+#include <atomic>
+
+// Vector paths on x86-64 only, where SSE2 is always present
+#if defined(__x86_64__) || defined(_M_X64)
+#define PARTICLE_KERNEL_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#else
+#define PARTICLE_KERNEL_X86 0
+#endif
+
+// GCC and Clang only emit AVX2 instructions inside functions marked for it;
+// MSVC accepts the intrinsics anywhere
+#if PARTICLE_KERNEL_X86 && (defined(__GNUC__) || defined(__clang__))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TARGET_AVX2
+#endif
+
+namespace {
+    const float GRAVITY_STEP = 0.1f;  // Light gravity
+    const float DRAG = 0.98f;         // Air resistance, also the shrink rate
+
+    // Set bits in each 4-bit value
+    const int BITS_SET[16] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+
+    typedef int (*IntegrateFunction)(const ParticleFields& fields, int begin, int count, uint32_t* aliveMask);
+
+    // Particles [begin, count), one at a time; also finishes off the vector paths
+    int integrateScalar(const ParticleFields& f, int begin, int count, uint32_t* aliveMask) {
+        int expired = 0;
+        for (int i = begin; i < count; i++) {
+            f.posX[i] += f.velX[i];
+            f.posY[i] += f.velY[i];
+            f.velY[i] += GRAVITY_STEP;
+            f.velX[i] *= DRAG;
+            f.life[i]++;
+            f.size[i] *= DRAG;
+
+            uint32_t bit = 1u << (i & 31);
+            if (f.life[i] < f.lifespan[i]) {
+                aliveMask[i >> 5] |= bit;
+            } else {
+                aliveMask[i >> 5] &= ~bit;
+                expired++;
+            }
+        }
+        return expired;
+    }
+
+#if PARTICLE_KERNEL_X86
+    // Four particles per step. Blocks start on multiples of 4, so each block's
+    // alive bits land inside a single mask word.
+    int integrateSSE2(const ParticleFields& f, int begin, int count, uint32_t* aliveMask) {
+        const __m128 gravity = _mm_set1_ps(GRAVITY_STEP);
+        const __m128 drag = _mm_set1_ps(DRAG);
+        const __m128i one = _mm_set1_epi32(1);
+
+        int alive = 0;
+        int i = begin;
+        for (; i + 4 <= count; i += 4) {
+            __m128 vx = _mm_loadu_ps(f.velX + i);
+            __m128 vy = _mm_loadu_ps(f.velY + i);
+            _mm_storeu_ps(f.posX + i, _mm_add_ps(_mm_loadu_ps(f.posX + i), vx));
+            _mm_storeu_ps(f.posY + i, _mm_add_ps(_mm_loadu_ps(f.posY + i), vy));
+            _mm_storeu_ps(f.velY + i, _mm_add_ps(vy, gravity));
+            _mm_storeu_ps(f.velX + i, _mm_mul_ps(vx, drag));
+            _mm_storeu_ps(f.size + i, _mm_mul_ps(_mm_loadu_ps(f.size + i), drag));
+
+            __m128i life = _mm_add_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(f.life + i)), one);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(f.life + i), life);
+            __m128i lifespan = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f.lifespan + i));
+
+            uint32_t bits = static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(life, lifespan))));
+            int shift = i & 31;
+            aliveMask[i >> 5] = (aliveMask[i >> 5] & ~(0xFu << shift)) | (bits << shift);
+            alive += BITS_SET[bits];
+        }
+        return (i - begin - alive) + integrateScalar(f, i, count, aliveMask);
+    }
+
+    // Eight particles per step, same layout as the SSE2 path
+    TARGET_AVX2 int integrateAVX2(const ParticleFields& f, int begin, int count, uint32_t* aliveMask) {
+        const __m256 gravity = _mm256_set1_ps(GRAVITY_STEP);
+        const __m256 drag = _mm256_set1_ps(DRAG);
+        const __m256i one = _mm256_set1_epi32(1);
+
+        int alive = 0;
+        int i = begin;
+        for (; i + 8 <= count; i += 8) {
+            __m256 vx = _mm256_loadu_ps(f.velX + i);
+            __m256 vy = _mm256_loadu_ps(f.velY + i);
+            _mm256_storeu_ps(f.posX + i, _mm256_add_ps(_mm256_loadu_ps(f.posX + i), vx));
+            _mm256_storeu_ps(f.posY + i, _mm256_add_ps(_mm256_loadu_ps(f.posY + i), vy));
+            _mm256_storeu_ps(f.velY + i, _mm256_add_ps(vy, gravity));
+            _mm256_storeu_ps(f.velX + i, _mm256_mul_ps(vx, drag));
+            _mm256_storeu_ps(f.size + i, _mm256_mul_ps(_mm256_loadu_ps(f.size + i), drag));
+
+            __m256i life = _mm256_add_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(f.life + i)), one);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(f.life + i), life);
+            __m256i lifespan = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(f.lifespan + i));
+
+            // life < lifespan, as lifespan > life
+            __m256i stillAlive = _mm256_cmpgt_epi32(lifespan, life);
+            uint32_t bits = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(stillAlive)));
+            int shift = i & 31;
+            aliveMask[i >> 5] = (aliveMask[i >> 5] & ~(0xFFu << shift)) | (bits << shift);
+            alive += BITS_SET[bits & 0xF] + BITS_SET[bits >> 4];
+        }
+
+        // Avoid the AVX-SSE transition penalty in whatever runs next
+        _mm256_zeroupper();
+        return (i - begin - alive) + integrateScalar(f, i, count, aliveMask);
+    }
+
+    bool cpuHasAVX2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7) {
+            return false;
+        }
+        __cpuid(info, 1);
+        bool osSavesYmm = (info[2] & (1 << 27)) && (_xgetbv(0) & 0x6) == 0x6;
+        __cpuidex(info, 7, 0);
+        return osSavesYmm && (info[1] & (1 << 5));
+#else
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+#endif
+    }
+#endif
+
+    IntegrateFunction functionFor(ParticleKernel::Level level) {
+#if PARTICLE_KERNEL_X86
+        switch (level) {
+        case ParticleKernel::AVX2: return integrateAVX2;
+        case ParticleKernel::SSE2: return integrateSSE2;
+        default: break;
+        }
+#endif
+        (void)level;
+        return integrateScalar;
+    }
+
+    std::atomic<int>& selectedLevel() {
+        static std::atomic<int> level(ParticleKernel::detectLevel());
+        return level;
+    }
+}
+
+ParticleKernel::Level ParticleKernel::detectLevel() {
+#if PARTICLE_KERNEL_X86
+    // SSE2 is part of every x86-64 CPU; AVX2 needs checking
+    return cpuHasAVX2() ? AVX2 : SSE2;
+#else
+    return SCALAR;
+#endif
+}
+
+ParticleKernel::Level ParticleKernel::getLevel() {
+    return static_cast<Level>(selectedLevel().load(std::memory_order_relaxed));
+}
+
+ParticleKernel::Level ParticleKernel::setLevel(Level level) {
+    Level supported = detectLevel();
+    Level chosen = level > supported ? supported : level;
+    selectedLevel().store(chosen, std::memory_order_relaxed);
+    return chosen;
+}
+
+const char* ParticleKernel::levelName(Level level) {
+    switch (level) {
+    case AVX2: return "avx2";
+    case SSE2: return "sse2";
+    default: return "scalar";
+    }
+}
+
+int ParticleKernel::integrate(const ParticleFields& fields, int count, uint32_t* aliveMask) {
+    int expired = functionFor(getLevel())(fields, 0, count, aliveMask);
+
+    // Keep bits past the end clear so the mask can be scanned word by word
+    if (count & 31) {
+        aliveMask[count >> 5] &= (1u << (count & 31)) - 1;
+    }
+    return expired;
+}
@@ -0,0 +1,230 @@
+#include "ParticlePool.h"
+#include "Snapshot.h"
+#include "ParticleKernel.h"
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace {
+    inline int lowestBit(uint32_t word) {
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        _BitScanForward(&index, word);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctz(word);
+#endif
+    }
+
+    // First index >= from whose alive bit equals wanted, or limit if there is none before it
+    int findBit(const uint32_t* mask, int from, int limit, bool wanted) {
+        while (from < limit) {
+            uint32_t word = wanted ? mask[from >> 5] : ~mask[from >> 5];
+            word &= ~0u << (from & 31);
+            if (word) {
+                int index = (from & ~31) + lowestBit(word);
+                return index < limit ? index : limit;
+            }
+            from = (from & ~31) + 32;
+        }
+        return limit;
+    }
+}
+
+ParticlePool::ParticlePool(int capacity)
+    : count(0), maxCount(capacity), budget(capacity), culled(0),
+      posX(capacity), posY(capacity), velX(capacity), velY(capacity), radius(capacity),
+      life(capacity), lifespan(capacity), color(capacity), blend(capacity), priority(capacity),
+      aliveMask(capacity / 32 + 1) {
+}
+
+bool ParticlePool::spawn(Vector2 position, Vector2 velocity, float size, int lifespanTicks, Color col,
+                         int blendMode, int priorityLevel) {
+    ParticleSpan span = claim(1, priorityLevel);
+    if (span.count == 0) {
+        return false;
+    }
+
+    span.posX[0] = position.x;
+    span.posY[0] = position.y;
+    span.velX[0] = velocity.x;
+    span.velY[0] = velocity.y;
+    span.size[0] = size;
+    span.life[0] = 0;
+    span.lifespan[0] = lifespanTicks;
+    span.color[0] = col;
+    span.blend[0] = static_cast<uint8_t>(blendMode);
+    return true;
+}
+
+bool ParticlePool::spawn(const Particle& particle) {
+    if (!spawn(particle.position, particle.velocity, particle.size, particle.lifespan, particle.color)) {
+        return false;
+    }
+    life[count - 1] = particle.currentLife;
+    return true;
+}
+
+int ParticlePool::spawn(const std::vector<Particle>& particles) {
+    int added = 0;
+    for (const Particle& particle : particles) {
+        if (!spawn(particle)) {
+            break;
+        }
+        added++;
+    }
+    return added;
+}
+
+ParticleSpan ParticlePool::claim(int requested, int priorityLevel) {
+    int share = shareOf(priorityLevel);
+
+    // Make room by culling lower priorities before clipping this spawn
+    if (requested > share - count && priorityLevel > PRIORITY_DEBRIS) {
+        cull(share - requested, priorityLevel);
+    }
+
+    int granted = requested < share - count ? requested : share - count;
+    if (granted < 0) {
+        granted = 0;
+    }
+    if (requested > granted) {
+        culled += requested - granted;
+    }
+
+    int first = count;
+    count += granted;
+    for (int i = first; i < count; i++) {
+        priority[i] = static_cast<uint8_t>(priorityLevel);
+    }
+
+    ParticleSpan span = {
+        granted,
+        posX.data() + first, posY.data() + first, velX.data() + first, velY.data() + first,
+        radius.data() + first, life.data() + first, lifespan.data() + first,
+        color.data() + first, blend.data() + first, priority.data() + first
+    };
+    return span;
+}
+
+void ParticlePool::setBudget(int maxParticles) {
+    budget = maxParticles < 0 ? 0 : (maxParticles > maxCount ? maxCount : maxParticles);
+}
+
+int ParticlePool::takeCulledCount() {
+    int taken = culled;
+    culled = 0;
+    return taken;
+}
+
+int ParticlePool::shareOf(int priorityLevel) const {
+    int level = priorityLevel < 0 ? 0 : (priorityLevel >= PRIORITY_COUNT ? PRIORITY_COUNT - 1 : priorityLevel);
+    return budget - (PRIORITY_COUNT - 1 - level) * (budget / 8);
+}
+
+void ParticlePool::cull(int target, int belowPriority) {
+    if (target < 0) {
+        target = 0;
+    }
+
+    for (int level = 0; level < belowPriority && count > target; level++) {
+        // Walking down means the particle moved into a hole has already been checked
+        for (int i = count - 1; i >= 0 && count > target; i--) {
+            if (priority[i] == level) {
+                moveParticle(count - 1, i);
+                count--;
+                culled++;
+            }
+        }
+    }
+}
+
+void ParticlePool::update() {
+    // A lowered budget sheds the least important particles first
+    if (count > budget) {
+        cull(budget, PRIORITY_COUNT);
+    }
+
+    // One pass integrates everything and marks the survivors
+    ParticleFields fields = {posX.data(), posY.data(), velX.data(), velY.data(), radius.data(), life.data(), lifespan.data()};
+    int expired = ParticleKernel::integrate(fields, count, aliveMask.data());
+    if (expired == 0) {
+        return;
+    }
+
+    // Survivors end up in [0, alive): each hole below alive takes the next
+    // survivor from at or above it. There are exactly as many of one as the other.
+    int alive = count - expired;
+    int hole = 0;
+    int source = alive;
+    while ((hole = findBit(aliveMask.data(), hole, alive, false)) < alive) {
+        source = findBit(aliveMask.data(), source, count, true);
+        moveParticle(source, hole);
+        hole++;
+        source++;
+    }
+    count = alive;
+}
+
+void ParticlePool::clear() {
+    count = 0;
+}
+
+Particle ParticlePool::get(int index) const {
+    Particle particle({posX[index], posY[index]}, {velX[index], velY[index]}, radius[index], lifespan[index], color[index]);
+    particle.currentLife = life[index];
+    return particle;
+}
+
+void ParticlePool::moveParticle(int from, int to) {
+    posX[to] = posX[from];
+    posY[to] = posY[from];
+    velX[to] = velX[from];
+    velY[to] = velY[from];
+    radius[to] = radius[from];
+    life[to] = life[from];
+    lifespan[to] = lifespan[from];
+    color[to] = color[from];
+    blend[to] = blend[from];
+    priority[to] = priority[from];
+}
+
+void ParticlePool::save(SnapshotWriter& writer) const {
+    writer.write(static_cast<uint32_t>(count));
+    writer.writeSpan(posX.data(), count);
+    writer.writeSpan(posY.data(), count);
+    writer.writeSpan(velX.data(), count);
+    writer.writeSpan(velY.data(), count);
+    writer.writeSpan(radius.data(), count);
+    writer.writeSpan(life.data(), count);
+    writer.writeSpan(lifespan.data(), count);
+    writer.writeSpan(color.data(), count);
+    writer.writeSpan(blend.data(), count);
+    writer.writeSpan(priority.data(), count);
+}
+
+bool ParticlePool::restore(SnapshotReader& reader) {
+    uint32_t saved;
+    if (!reader.read(saved) || saved > static_cast<uint32_t>(maxCount)) {
+        count = 0;
+        return false;
+    }
+
+    count = static_cast<int>(saved);
+    reader.readSpan(posX.data(), count);
+    reader.readSpan(posY.data(), count);
+    reader.readSpan(velX.data(), count);
+    reader.readSpan(velY.data(), count);
+    reader.readSpan(radius.data(), count);
+    reader.readSpan(life.data(), count);
+    reader.readSpan(lifespan.data(), count);
+    reader.readSpan(color.data(), count);
+    reader.readSpan(blend.data(), count);
+    reader.readSpan(priority.data(), count);
+
+    if (reader.hasFailed()) {
+        count = 0;
+        return false;
+    }
+    return true;
+}
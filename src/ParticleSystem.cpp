@@ -1,4 +1,5 @@
 #include "ParticleSystem.h"
+#include "Random.h"
 #include <math.h>
 
 // Create splash particles for effects like landing, hits, etc.
@@ -7,24 +8,24 @@ std::vector<Particle> createSplashParticles(Vector2 position, int count) {
 
     for (int i = 0; i < count; i++) {
         // Random velocity in all directions
-        float angle = GetRandomValue(0, 360) * DEG2RAD;
-        float speed = GetRandomValue(2, 6);
+        float angle = cosmeticRandom(0, 360) * DEG2RAD;
+        float speed = cosmeticRandom(2, 6);
         Vector2 velocity = {
             cosf(angle) * speed,
             sinf(angle) * speed
         };
 
         // Random size
-        float size = GetRandomValue(2, 6);
+        float size = cosmeticRandom(2, 6);
 
         // Random lifespan
-        int lifespan = GetRandomValue(20, 40);
+        int lifespan = cosmeticRandom(20, 40);
 
         // Random color variations (white to light blue)
         Color color = {
-            (unsigned char)GetRandomValue(200, 255),
-            (unsigned char)GetRandomValue(200, 255),
-            (unsigned char)GetRandomValue(230, 255),
+            (unsigned char)cosmeticRandom(200, 255),
+            (unsigned char)cosmeticRandom(200, 255),
+            (unsigned char)cosmeticRandom(230, 255),
             255
         };
 
@@ -40,24 +41,24 @@ std::vector<Particle> createBlastParticles(Vector2 position, int count, Color ba
 
     for (int i = 0; i < count; i++) {
         // Random velocity in all directions but stronger
-        float angle = GetRandomValue(0, 360) * DEG2RAD;
-        float speed = GetRandomValue(5, 12);
+        float angle = cosmeticRandom(0, 360) * DEG2RAD;
+        float speed = cosmeticRandom(5, 12);
         Vector2 velocity = {
             cosf(angle) * speed,
             sinf(angle) * speed
         };
 
         // Larger random size
-        float size = GetRandomValue(4, 10);
+        float size = cosmeticRandom(4, 10);
 
         // Longer lifespan
-        int lifespan = GetRandomValue(30, 60);
+        int lifespan = cosmeticRandom(30, 60);
 
         // Color variations based on the input color
         Color color = {
-            (unsigned char)clamp(baseColor.r + GetRandomValue(-20, 20), 0, 255),
-            (unsigned char)clamp(baseColor.g + GetRandomValue(-20, 20), 0, 255),
-            (unsigned char)clamp(baseColor.b + GetRandomValue(-20, 20), 0, 255),
+            (unsigned char)clamp(baseColor.r + cosmeticRandom(-20, 20), 0, 255),
+            (unsigned char)clamp(baseColor.g + cosmeticRandom(-20, 20), 0, 255),
+            (unsigned char)clamp(baseColor.b + cosmeticRandom(-20, 20), 0, 255),
             255
         };
 
@@ -74,22 +75,22 @@ std::vector<Particle> createExplosionParticles(Vector2 position, int count, Colo
 
     for (int i = 0; i < count; i++) {
         // Random angle and speed
-        float angle = GetRandomValue(0, 360) * DEG2RAD;
-        float speed = GetRandomValue(2, 8);
+        float angle = cosmeticRandom(0, 360) * DEG2RAD;
+        float speed = cosmeticRandom(2, 8);
         Vector2 velocity = {
             cosf(angle) * speed,
             sinf(angle) * speed
         };
 
         // Random particle properties
-        float size = GetRandomValue(2, 6);
-        int lifespan = GetRandomValue(15, 45);
+        float size = cosmeticRandom(2, 6);
+        int lifespan = cosmeticRandom(15, 45);
 
         // Slightly vary the color
         Color particleColor = baseColor;
-        particleColor.r = (unsigned char)clamp(particleColor.r + GetRandomValue(-20, 20), 0, 255);
-        particleColor.g = (unsigned char)clamp(particleColor.g + GetRandomValue(-20, 20), 0, 255);
-        particleColor.b = (unsigned char)clamp(particleColor.b + GetRandomValue(-20, 20), 0, 255);
+        particleColor.r = (unsigned char)clamp(particleColor.r + cosmeticRandom(-20, 20), 0, 255);
+        particleColor.g = (unsigned char)clamp(particleColor.g + cosmeticRandom(-20, 20), 0, 255);
+        particleColor.b = (unsigned char)clamp(particleColor.b + cosmeticRandom(-20, 20), 0, 255);
 
         particles.push_back(Particle(position, velocity, size, lifespan, particleColor));
     }
@@ -106,17 +107,17 @@ std::vector<Particle> createHitParticles(Vector2 position, Vector2 direction, in
 
     for (int i = 0; i < count; i++) {
         // Particles spread in the general direction of the hit
-        float angleSpread = GetRandomValue(-30, 30) * DEG2RAD;
+        float angleSpread = cosmeticRandom(-30, 30) * DEG2RAD;
         float angle = baseAngle + angleSpread;
-        float speed = GetRandomValue(3, 8);
+        float speed = cosmeticRandom(3, 8);
 
         Vector2 velocity = {
             cosf(angle) * speed,
             sinf(angle) * speed
         };
 
-        float size = GetRandomValue(2, 5);
-        int lifespan = GetRandomValue(10, 25);
+        float size = cosmeticRandom(2, 5);
+        int lifespan = cosmeticRandom(10, 25);
 
         particles.push_back(Particle(position, velocity, size, lifespan, color));
     }
@@ -130,35 +131,35 @@ std::vector<Particle> createMassiveExplosionParticles(Vector2 position, int coun
     // Create core explosion particles
     for (int i = 0; i < count; i++) {
         // Random velocity in all directions but with high speed
-        float angle = GetRandomValue(0, 360) * DEG2RAD;
-        float speed = GetRandomValue(8, 20);  // Higher speed than regular explosions
+        float angle = cosmeticRandom(0, 360) * DEG2RAD;
+        float speed = cosmeticRandom(8, 20);  // Higher speed than regular explosions
         Vector2 velocity = {
             cosf(angle) * speed,
             sinf(angle) * speed
         };
 
         // Larger random size
-        float size = GetRandomValue(5, 15);  // Bigger particles
+        float size = cosmeticRandom(5, 15);  // Bigger particles
 
         // Longer lifespan
-        int lifespan = GetRandomValue(40, 100);  // Particles last longer
+        int lifespan = cosmeticRandom(40, 100);  // Particles last longer
 
         // Color variations based on the input color
         Color color;
 
         // Mix of fire colors and character colors
-        int colorType = GetRandomValue(0, 10);
+        int colorType = cosmeticRandom(0, 10);
         if (colorType < 3) {
             // Use character color with variations
             color = {
-                (unsigned char)clamp(baseColor.r + GetRandomValue(-20, 20), 0, 255),
-                (unsigned char)clamp(baseColor.g + GetRandomValue(-20, 20), 0, 255),
-                (unsigned char)clamp(baseColor.b + GetRandomValue(-20, 20), 0, 255),
+                (unsigned char)clamp(baseColor.r + cosmeticRandom(-20, 20), 0, 255),
+                (unsigned char)clamp(baseColor.g + cosmeticRandom(-20, 20), 0, 255),
+                (unsigned char)clamp(baseColor.b + cosmeticRandom(-20, 20), 0, 255),
                 255
             };
         } else if (colorType < 7) {
             // Fire colors (red, orange, yellow)
-            int firePalette = GetRandomValue(0, 2);
+            int firePalette = cosmeticRandom(0, 2);
             switch (firePalette) {
                 case 0: color = RED; break;
                 case 1: color = ORANGE; break;
@@ -166,7 +167,7 @@ std::vector<Particle> createMassiveExplosionParticles(Vector2 position, int coun
             }
         } else {
             // White/smoke particles
-            int grayscale = GetRandomValue(180, 255);
+            int grayscale = cosmeticRandom(180, 255);
             color = {
                 (unsigned char)grayscale,
                 (unsigned char)grayscale,
@@ -182,22 +183,22 @@ std::vector<Particle> createMassiveExplosionParticles(Vector2 position, int coun
     int sparkCount = count / 4;
     for (int i = 0; i < sparkCount; i++) {
         // Random velocity in all directions but with higher speed
-        float angle = GetRandomValue(0, 360) * DEG2RAD;
-        float speed = GetRandomValue(15, 30);  // Spark particles move faster
+        float angle = cosmeticRandom(0, 360) * DEG2RAD;
+        float speed = cosmeticRandom(15, 30);  // Spark particles move faster
         Vector2 velocity = {
             cosf(angle) * speed,
             sinf(angle) * speed
         };
 
         // Smaller spark size
-        float size = GetRandomValue(1, 3);  // Small sparks
+        float size = cosmeticRandom(1, 3);  // Small sparks
 
         // Short lifespan
-        int lifespan = GetRandomValue(10, 30);  // Short-lived sparks
+        int lifespan = cosmeticRandom(10, 30);  // Short-lived sparks
 
         // Bright colors for sparks
         Color color;
-        int sparkColor = GetRandomValue(0, 2);
+        int sparkColor = cosmeticRandom(0, 2);
         switch (sparkColor) {
             case 0: color = YELLOW; break;
             case 1: color = WHITE; break;
@@ -211,22 +212,22 @@ std::vector<Particle> createMassiveExplosionParticles(Vector2 position, int coun
     int debrisCount = count / 5;
     for (int i = 0; i < debrisCount; i++) {
         // Random velocity in all directions with medium speed
-        float angle = GetRandomValue(0, 360) * DEG2RAD;
-        float speed = GetRandomValue(5, 12);
+        float angle = cosmeticRandom(0, 360) * DEG2RAD;
+        float speed = cosmeticRandom(5, 12);
         Vector2 velocity = {
             cosf(angle) * speed,
             sinf(angle) * speed
         };
 
         // Medium size debris
-        float size = GetRandomValue(3, 8);
+        float size = cosmeticRandom(3, 8);
 
         // Medium lifespan
-        int lifespan = GetRandomValue(30, 70);
+        int lifespan = cosmeticRandom(30, 70);
 
         // Dark colors for debris
         Color color;
-        int debrisColor = GetRandomValue(0, 3);
+        int debrisColor = cosmeticRandom(0, 3);
         switch (debrisColor) {
             case 0: color = DARKGRAY; break;
             case 1: color = BLACK; break;
@@ -251,13 +252,4 @@ bool updateParticles(std::vector<Particle>& particles) {
     }
 
     return !particles.empty();
-}
-
-// Function to draw particles
-void drawParticles(const std::vector<Particle>& particles) {
-    for (int i = 0; i < particles.size(); i++) {
-        // Create a non-const copy to work around the const issue
-        Particle p = particles[i];
-        p.draw();
-    }
 }
\ No newline at end of file
@@ -0,0 +1,166 @@
+#include "PlatformGrid.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    // Stages far larger than the screen grow the cells rather than the grid
+    const int MAX_CELLS = 1 << 16;
+}
+
+// About a character's width, so a character touches a handful of cells
+const float PlatformGrid::DEFAULT_CELL_SIZE = 128.0f;
+
+PlatformGrid::PlatformGrid()
+    : platformCount(0), originX(0.0f), originY(0.0f), cellSize(DEFAULT_CELL_SIZE),
+      inverseCellSize(1.0f / DEFAULT_CELL_SIZE), columns(0), rows(0)
+{
+}
+
+void PlatformGrid::build(const std::vector<Platform>& platforms, float size)
+{
+    std::vector<Rectangle> bounds;
+    bounds.reserve(platforms.size());
+    for (const Platform& platform : platforms)
+    {
+        bounds.push_back(platform.rect);
+    }
+    build(bounds, size);
+}
+
+void PlatformGrid::build(const std::vector<Rectangle>& bounds, float size)
+{
+    clear();
+    platformCount = static_cast<int>(bounds.size());
+    if (bounds.empty())
+    {
+        return;
+    }
+
+    // Bounding box of every platform
+    float minX = bounds[0].x;
+    float minY = bounds[0].y;
+    float maxX = minX + bounds[0].width;
+    float maxY = minY + bounds[0].height;
+    for (const Rectangle& rect : bounds)
+    {
+        minX = std::min(minX, rect.x);
+        minY = std::min(minY, rect.y);
+        maxX = std::max(maxX, rect.x + rect.width);
+        maxY = std::max(maxY, rect.y + rect.height);
+    }
+
+    cellSize = size > 1.0f ? size : 1.0f;
+    while (std::ceil((maxX - minX) / cellSize + 1.0f) * std::ceil((maxY - minY) / cellSize + 1.0f) > MAX_CELLS)
+    {
+        cellSize *= 2.0f;
+    }
+    inverseCellSize = 1.0f / cellSize;
+    originX = minX;
+    originY = minY;
+    columns = static_cast<int>((maxX - minX) * inverseCellSize) + 1;
+    rows = static_cast<int>((maxY - minY) * inverseCellSize) + 1;
+
+    // Count, prefix-sum, then fill, so each cell's platforms sit together in ascending order
+    firstColumn.resize(platformCount);
+    firstRow.resize(platformCount);
+    cellStart.assign(columns * rows + 1, 0);
+    for (int i = 0; i < platformCount; i++)
+    {
+        const Rectangle& rect = bounds[i];
+        firstColumn[i] = columnOf(rect.x);
+        firstRow[i] = rowOf(rect.y);
+        for (int r = firstRow[i]; r <= rowOf(rect.y + rect.height); r++)
+        {
+            for (int c = firstColumn[i]; c <= columnOf(rect.x + rect.width); c++)
+            {
+                cellStart[r * columns + c + 1]++;
+            }
+        }
+    }
+
+    for (int c = 0; c < columns * rows; c++)
+    {
+        cellStart[c + 1] += cellStart[c];
+    }
+
+    items.resize(cellStart.back());
+    std::vector<int> fill(cellStart.begin(), cellStart.end() - 1);
+    for (int i = 0; i < platformCount; i++)
+    {
+        const Rectangle& rect = bounds[i];
+        for (int r = firstRow[i]; r <= rowOf(rect.y + rect.height); r++)
+        {
+            for (int c = firstColumn[i]; c <= columnOf(rect.x + rect.width); c++)
+            {
+                items[fill[r * columns + c]++] = i;
+            }
+        }
+    }
+}
+
+void PlatformGrid::clear()
+{
+    platformCount = 0;
+    columns = 0;
+    rows = 0;
+    cellStart.clear();
+    items.clear();
+    firstColumn.clear();
+    firstRow.clear();
+}
+
+void PlatformGrid::query(Rectangle area, std::vector<int>& out) const
+{
+    out.clear();
+    if (platformCount == 0)
+    {
+        return;
+    }
+
+    int column0 = columnOf(area.x);
+    int column1 = columnOf(area.x + area.width);
+    int row0 = rowOf(area.y);
+    int row1 = rowOf(area.y + area.height);
+
+    for (int r = row0; r <= row1; r++)
+    {
+        for (int c = column0; c <= column1; c++)
+        {
+            int cell = r * columns + c;
+            for (int k = cellStart[cell]; k < cellStart[cell + 1]; k++)
+            {
+                int index = items[k];
+                if (c == std::max(column0, firstColumn[index]) && r == std::max(row0, firstRow[index]))
+                {
+                    out.push_back(index);
+                }
+            }
+        }
+    }
+
+    // Usually a handful, and runs from each cell are already sorted
+    for (size_t i = 1; i < out.size(); i++)
+    {
+        int value = out[i];
+        size_t j = i;
+        while (j > 0 && out[j - 1] > value)
+        {
+            out[j] = out[j - 1];
+            j--;
+        }
+        out[j] = value;
+    }
+}
+
+int PlatformGrid::columnOf(float x) const
+{
+    int column = static_cast<int>(std::floor((x - originX) * inverseCellSize));
+    return column < 0 ? 0 : (column >= columns ? columns - 1 : column);
+}
+
+int PlatformGrid::rowOf(float y) const
+{
+    int row = static_cast<int>(std::floor((y - originY) * inverseCellSize));
+    return row < 0 ? 0 : (row >= rows ? rows - 1 : row);
+}
@@ -0,0 +1,128 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define PROFILER_USE_TSC 1
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#else
+#define PROFILER_USE_TSC 0
+#endif
+
+namespace {
+    int64_t steadyNanos() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+Profiler& Profiler::get() {
+    thread_local Profiler profiler;
+    return profiler;
+}
+
+uint64_t Profiler::now() {
+#if PROFILER_USE_TSC
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(steadyNanos());
+#endif
+}
+
+Profiler::Profiler()
+    : historyIndex(0), frameStartTicks(now()), frameStartNanos(steadyNanos()), nanosPerTick(1.0) {
+    std::memset(frameHistory, 0, sizeof(frameHistory));
+}
+
+int Profiler::findOrAddZone(const char* name, int parent) {
+    // Few zones, so a linear scan beats hashing here
+    for (size_t i = 0; i < zones.size(); i++) {
+        if (zones[i].name == name && zones[i].parent == parent) {
+            return static_cast<int>(i);
+        }
+    }
+
+    Zone zone;
+    std::memset(&zone, 0, sizeof(zone));
+    zone.name = name;
+    zone.parent = parent;
+    zone.depth = parent >= 0 ? zones[parent].depth + 1 : 0;
+    zones.push_back(zone);
+    return static_cast<int>(zones.size() - 1);
+}
+
+void Profiler::begin(const char* name) {
+    int parent = stack.empty() ? -1 : stack.back().zone;
+    stack.push_back({findOrAddZone(name, parent), now()});
+}
+
+void Profiler::end() {
+    if (stack.empty()) {
+        return;
+    }
+
+    OpenZone open = stack.back();
+    stack.pop_back();
+
+    Zone& zone = zones[open.zone];
+    zone.ticks += now() - open.start;
+    zone.calls++;
+}
+
+void Profiler::endFrame() {
+    uint64_t ticks = now();
+    int64_t nanos = steadyNanos();
+
+    // Calibrate ticks against wall time over the frame that just ended
+    uint64_t frameTicks = ticks - frameStartTicks;
+    double frameNanos = static_cast<double>(nanos - frameStartNanos);
+    if (frameTicks > 0 && frameNanos > 0.0) {
+        nanosPerTick = frameNanos / frameTicks;
+    }
+
+    frameHistory[historyIndex] = static_cast<float>(frameNanos / 1e6);
+
+    for (auto& zone : zones) {
+        zone.history[historyIndex] = static_cast<float>(zone.ticks * nanosPerTick / 1e6);
+        zone.lastCalls = zone.calls;
+        zone.ticks = 0;
+        zone.calls = 0;
+
+        float sum = 0.0f;
+        zone.maxMs = 0.0f;
+        for (float ms : zone.history) {
+            sum += ms;
+            zone.maxMs = std::max(zone.maxMs, ms);
+        }
+        zone.averageMs = sum / PROFILE_HISTORY_FRAMES;
+    }
+
+    historyIndex = (historyIndex + 1) % PROFILE_HISTORY_FRAMES;
+    frameStartTicks = ticks;
+    frameStartNanos = nanos;
+}
+
+float Profiler::getFrameMs(int framesAgo) const {
+    int index = (historyIndex - 1 - framesAgo) % PROFILE_HISTORY_FRAMES;
+    if (index < 0) {
+        index += PROFILE_HISTORY_FRAMES;
+    }
+    return frameHistory[index];
+}
+
+float Profiler::getAverageFrameMs() const {
+    float sum = 0.0f;
+    for (float ms : frameHistory) {
+        sum += ms;
+    }
+    return sum / PROFILE_HISTORY_FRAMES;
+}
+
+float Profiler::getMaxFrameMs() const {
+    return *std::max_element(frameHistory, frameHistory + PROFILE_HISTORY_FRAMES);
+}
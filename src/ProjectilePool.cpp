@@ -0,0 +1,180 @@
+#include "ProjectilePool.h"
+#include "CharacterConfig.h"
+#include "Snapshot.h"
+#include "StateHash.h"
+
+namespace {
+    // Only code running outside a world (benchmarks, tools) lands here
+    const int DEFAULT_POOL_CAPACITY = 64;
+
+    thread_local ProjectilePool* boundProjectiles = nullptr;
+
+    ProjectilePool& defaultProjectiles() {
+        thread_local ProjectilePool projectiles(DEFAULT_POOL_CAPACITY);
+        return projectiles;
+    }
+}
+
+ProjectilePool::ProjectilePool(int capacity)
+    : count(0), maxCount(capacity),
+      posX(capacity), posY(capacity), width(capacity), height(capacity), velX(capacity), velY(capacity),
+      life(capacity), owner(capacity), hit(capacity), destroyOnHit(capacity) {
+}
+
+bool ProjectilePool::spawn(int ownerSlot, Rect rect, Vec2 velocity, int lifetime,
+                           const ProjectileHit& hitProperties, bool destroy) {
+    if (count >= maxCount) {
+        return false;
+    }
+
+    posX[count] = rect.x;
+    posY[count] = rect.y;
+    width[count] = rect.width;
+    height[count] = rect.height;
+    velX[count] = velocity.x;
+    velY[count] = velocity.y;
+    life[count] = lifetime;
+    owner[count] = ownerSlot;
+    hit[count] = hitProperties;
+    destroyOnHit[count] = destroy ? 1 : 0;
+    count++;
+    return true;
+}
+
+void ProjectilePool::update() {
+    Real* x = posX.data();
+    Real* y = posY.data();
+    const Real* vx = velX.data();
+    const Real* vy = velY.data();
+    int* ticks = life.data();
+
+    const Real left = GameConfig::BLAST_ZONE_LEFT;
+    const Real right = GameConfig::BLAST_ZONE_RIGHT;
+    const Real top = GameConfig::BLAST_ZONE_TOP;
+    const Real bottom = GameConfig::BLAST_ZONE_BOTTOM;
+
+    // Straight loops over the arrays, so the compiler vectorizes them
+    for (int i = 0; i < count; i++) {
+        x[i] += vx[i];
+        y[i] += vy[i];
+        ticks[i] -= 1;
+    }
+
+    // Past a blast zone counts as expired
+    for (int i = 0; i < count; i++) {
+        bool outside = x[i] < left || x[i] > right || y[i] < top || y[i] > bottom;
+        ticks[i] = outside ? 0 : ticks[i];
+    }
+
+    removeSpent();
+}
+
+void ProjectilePool::removeSpent() {
+    int kept = 0;
+    for (int i = 0; i < count; i++) {
+        if (life[i] <= 0) {
+            continue;
+        }
+        if (kept != i) {
+            posX[kept] = posX[i];
+            posY[kept] = posY[i];
+            width[kept] = width[i];
+            height[kept] = height[i];
+            velX[kept] = velX[i];
+            velY[kept] = velY[i];
+            life[kept] = life[i];
+            owner[kept] = owner[i];
+            hit[kept] = hit[i];
+            destroyOnHit[kept] = destroyOnHit[i];
+        }
+        kept++;
+    }
+    count = kept;
+}
+
+void ProjectilePool::clear() {
+    count = 0;
+}
+
+AttackBox ProjectilePool::attackBox(int index) const {
+    const ProjectileHit& properties = hit[index];
+    AttackBox box(rect(index), properties.damage, properties.baseKnockback, properties.knockbackScaling,
+                  properties.knockbackAngle, properties.hitLag, life[index], {velX[index], velY[index]},
+                  destroyOnHit[index] != 0);
+    box.shieldStun = properties.shieldStun;
+    return box;
+}
+
+void ProjectilePool::save(SnapshotWriter& writer) const {
+    writer.write(static_cast<uint32_t>(count));
+    writer.writeSpan(posX.data(), count);
+    writer.writeSpan(posY.data(), count);
+    writer.writeSpan(width.data(), count);
+    writer.writeSpan(height.data(), count);
+    writer.writeSpan(velX.data(), count);
+    writer.writeSpan(velY.data(), count);
+    writer.writeSpan(life.data(), count);
+    writer.writeSpan(owner.data(), count);
+    writer.writeSpan(hit.data(), count);
+    writer.writeSpan(destroyOnHit.data(), count);
+}
+
+bool ProjectilePool::restore(SnapshotReader& reader) {
+    uint32_t saved;
+    if (!reader.read(saved) || saved > static_cast<uint32_t>(maxCount)) {
+        count = 0;
+        return false;
+    }
+
+    count = static_cast<int>(saved);
+    reader.readSpan(posX.data(), count);
+    reader.readSpan(posY.data(), count);
+    reader.readSpan(width.data(), count);
+    reader.readSpan(height.data(), count);
+    reader.readSpan(velX.data(), count);
+    reader.readSpan(velY.data(), count);
+    reader.readSpan(life.data(), count);
+    reader.readSpan(owner.data(), count);
+    reader.readSpan(hit.data(), count);
+    reader.readSpan(destroyOnHit.data(), count);
+
+    if (reader.hasFailed()) {
+        count = 0;
+        return false;
+    }
+    return true;
+}
+
+void ProjectilePool::hash(StateHasher& hasher) const {
+    hasher.add(count);
+    for (int i = 0; i < count; i++) {
+        hasher.add(posX[i]);
+        hasher.add(posY[i]);
+        hasher.add(width[i]);
+        hasher.add(height[i]);
+        hasher.add(velX[i]);
+        hasher.add(velY[i]);
+        hasher.add(life[i]);
+        hasher.add(owner[i]);
+        hasher.add(hit[i].damage);
+        hasher.add(hit[i].baseKnockback);
+        hasher.add(hit[i].knockbackScaling);
+        hasher.add(hit[i].knockbackAngle);
+        hasher.add(hit[i].hitLag);
+        hasher.add(hit[i].shieldStun);
+        hasher.add(destroyOnHit[i]);
+    }
+}
+
+ProjectileScope::ProjectileScope(ProjectilePool& projectiles)
+    : previous(boundProjectiles) {
+    boundProjectiles = &projectiles;
+}
+
+ProjectileScope::~ProjectileScope() {
+    boundProjectiles = previous;
+}
+
+ProjectilePool& currentProjectiles() {
+    return boundProjectiles ? *boundProjectiles : defaultProjectiles();
+}
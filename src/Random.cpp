@@ -0,0 +1,118 @@
+#include "Random.h"
+
+namespace {
+    // Salt so the cosmetic stream never mirrors the gameplay stream
+    const uint64_t COSMETIC_STREAM_SALT = 0x9E3779B97F4A7C15ULL;
+
+    thread_local RandomStreams defaultStreams;
+    thread_local RandomStreams* boundStreams = nullptr;
+
+    uint64_t splitMix64(uint64_t& x) {
+        uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    inline uint32_t rotl(uint32_t x, int k) {
+        return (x << k) | (x >> (32 - k));
+    }
+
+    inline RandomStreams& currentStreams() {
+        return boundStreams ? *boundStreams : defaultStreams;
+    }
+}
+
+Random::Random(uint64_t seedValue) {
+    seed(seedValue);
+}
+
+void Random::seed(uint64_t seedValue) {
+    uint64_t x = seedValue;
+    uint64_t a = splitMix64(x);
+    uint64_t b = splitMix64(x);
+    state[0] = static_cast<uint32_t>(a);
+    state[1] = static_cast<uint32_t>(a >> 32);
+    state[2] = static_cast<uint32_t>(b);
+    state[3] = static_cast<uint32_t>(b >> 32);
+}
+
+uint32_t Random::next() {
+    const uint32_t result = rotl(state[1] * 5, 7) * 9;
+    const uint32_t t = state[1] << 9;
+
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = rotl(state[3], 11);
+
+    return result;
+}
+
+int Random::range(int min, int max) {
+    if (min > max) {
+        int tmp = min;
+        min = max;
+        max = tmp;
+    }
+
+    // Multiply-shift maps a 32-bit value onto the span without a division
+    uint64_t span = static_cast<uint64_t>(static_cast<int64_t>(max) - min + 1);
+    return static_cast<int>(min + static_cast<int64_t>((next() * span) >> 32));
+}
+
+float Random::unit() {
+    // Top 24 bits give every representable float step in [0, 1)
+    return (next() >> 8) * (1.0f / 16777216.0f);
+}
+
+void Random::fill(uint32_t* out, int count) {
+    uint32_t s0 = state[0], s1 = state[1], s2 = state[2], s3 = state[3];
+    for (int i = 0; i < count; i++) {
+        out[i] = rotl(s1 * 5, 7) * 9;
+        const uint32_t t = s1 << 9;
+
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        s3 = rotl(s3, 11);
+    }
+    state[0] = s0;
+    state[1] = s1;
+    state[2] = s2;
+    state[3] = s3;
+}
+
+RandomStreams::RandomStreams(uint64_t matchSeed) {
+    seed(matchSeed);
+}
+
+void RandomStreams::seed(uint64_t matchSeed) {
+    gameplay.seed(matchSeed);
+    cosmetic.seed(matchSeed ^ COSMETIC_STREAM_SALT);
+}
+
+RandomScope::RandomScope(RandomStreams& streams)
+    : previous(boundStreams) {
+    boundStreams = &streams;
+}
+
+RandomScope::~RandomScope() {
+    boundStreams = previous;
+}
+
+int gameplayRandom(int min, int max) {
+    return currentStreams().gameplay.range(min, max);
+}
+
+int cosmeticRandom(int min, int max) {
+    return currentStreams().cosmetic.range(min, max);
+}
+
+Random& cosmeticStream() {
+    return currentStreams().cosmetic;
+}
@@ -0,0 +1,295 @@
+#include "Replay.h"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace
+{
+    const char REPLAY_MAGIC[4] = {'V', 'B', 'R', 'P'};
+    const uint8_t REPLAY_VERSION = 1;
+
+    // Helpers for the little-endian byte stream
+    void writeVarint(std::vector<uint8_t>& out, uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            out.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<uint8_t>(value));
+    }
+
+    void writeU64(std::vector<uint8_t>& out, uint64_t value)
+    {
+        for (int i = 0; i < 8; i++)
+        {
+            out.push_back(static_cast<uint8_t>(value >> (i * 8)));
+        }
+    }
+
+    void writeF32(std::vector<uint8_t>& out, float value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        for (int i = 0; i < 4; i++)
+        {
+            out.push_back(static_cast<uint8_t>(bits >> (i * 8)));
+        }
+    }
+
+    // Bounds-checked reader; every read fails once the data runs out
+    struct ByteReader
+    {
+        const std::vector<uint8_t>& data;
+        size_t pos;
+
+        explicit ByteReader(const std::vector<uint8_t>& bytes) : data(bytes), pos(0) {}
+
+        bool readU8(uint8_t& value)
+        {
+            if (pos >= data.size()) return false;
+            value = data[pos++];
+            return true;
+        }
+
+        bool readU64(uint64_t& value)
+        {
+            if (data.size() - pos < 8) return false;
+            value = 0;
+            for (int i = 0; i < 8; i++)
+            {
+                value |= static_cast<uint64_t>(data[pos++]) << (i * 8);
+            }
+            return true;
+        }
+
+        bool readF32(float& value)
+        {
+            if (data.size() - pos < 4) return false;
+            uint32_t bits = 0;
+            for (int i = 0; i < 4; i++)
+            {
+                bits |= static_cast<uint32_t>(data[pos++]) << (i * 8);
+            }
+            std::memcpy(&value, &bits, sizeof(value));
+            return true;
+        }
+
+        bool readVarint(uint64_t& value)
+        {
+            value = 0;
+            for (int shift = 0; shift < 64; shift += 7)
+            {
+                uint8_t byte;
+                if (!readU8(byte)) return false;
+                value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0) return true;
+            }
+            return false;
+        }
+    };
+}
+
+ReplayRecorder::ReplayRecorder(const ReplayHeader& replayHeader)
+    : header(replayHeader), runs(replayHeader.playerCount)
+{
+    header.frameCount = 0;
+}
+
+void ReplayRecorder::record(const std::vector<PlayerInput>& inputs)
+{
+    for (size_t i = 0; i < runs.size(); i++)
+    {
+        uint16_t buttons = i < inputs.size() ? inputs[i].buttons : 0;
+
+        // Extend the current run while the buttons stay the same
+        std::vector<ReplayRun>& playerRuns = runs[i];
+        if (!playerRuns.empty() && playerRuns.back().buttons == buttons)
+        {
+            playerRuns.back().length++;
+        }
+        else
+        {
+            playerRuns.push_back({buttons, 1});
+        }
+    }
+
+    header.frameCount++;
+}
+
+std::vector<uint8_t> ReplayRecorder::encode() const
+{
+    std::vector<uint8_t> out;
+
+    // Header
+    out.insert(out.end(), REPLAY_MAGIC, REPLAY_MAGIC + sizeof(REPLAY_MAGIC));
+    out.push_back(REPLAY_VERSION);
+    writeU64(out, header.seed);
+    out.push_back(header.stageId);
+    out.push_back(header.playerCount);
+    out.push_back(header.stockCount);
+    out.push_back(header.aiEnabled ? 1 : 0);
+    writeF32(out, header.aiDifficulty);
+    writeVarint(out, header.frameCount);
+
+    // Input runs, one stream per player
+    for (const auto& playerRuns : runs)
+    {
+        writeVarint(out, playerRuns.size());
+        for (const auto& run : playerRuns)
+        {
+            writeVarint(out, run.buttons);
+            writeVarint(out, run.length);
+        }
+    }
+
+    return out;
+}
+
+bool ReplayRecorder::save(const std::string& path) const
+{
+    std::vector<uint8_t> bytes = encode();
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    return file.good();
+}
+
+ReplayPlayer::ReplayPlayer()
+    : frame(0)
+{
+}
+
+bool ReplayPlayer::load(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return decode(bytes);
+}
+
+bool ReplayPlayer::decode(const std::vector<uint8_t>& data)
+{
+    header = ReplayHeader();
+    runs.clear();
+    rewind();
+
+    ByteReader reader(data);
+
+    // Magic and version
+    for (int i = 0; i < 4; i++)
+    {
+        uint8_t byte;
+        if (!reader.readU8(byte) || byte != static_cast<uint8_t>(REPLAY_MAGIC[i]))
+        {
+            return false;
+        }
+    }
+
+    uint8_t version;
+    if (!reader.readU8(version) || version != REPLAY_VERSION)
+    {
+        return false;
+    }
+
+    // Header
+    ReplayHeader parsed;
+    uint8_t aiFlag;
+    uint64_t frameCount;
+    if (!reader.readU64(parsed.seed) ||
+        !reader.readU8(parsed.stageId) ||
+        !reader.readU8(parsed.playerCount) ||
+        !reader.readU8(parsed.stockCount) ||
+        !reader.readU8(aiFlag) ||
+        !reader.readF32(parsed.aiDifficulty) ||
+        !reader.readVarint(frameCount) ||
+        frameCount > UINT32_MAX)
+    {
+        return false;
+    }
+    parsed.aiEnabled = aiFlag != 0;
+    parsed.frameCount = static_cast<uint32_t>(frameCount);
+
+    // Input runs; each player's runs must cover exactly frameCount frames
+    std::vector<std::vector<ReplayRun>> parsedRuns(parsed.playerCount);
+    for (auto& playerRuns : parsedRuns)
+    {
+        uint64_t runCount;
+        if (!reader.readVarint(runCount) || runCount > parsed.frameCount)
+        {
+            return false;
+        }
+
+        uint64_t covered = 0;
+        playerRuns.reserve(static_cast<size_t>(runCount));
+        for (uint64_t r = 0; r < runCount; r++)
+        {
+            uint64_t buttons, length;
+            if (!reader.readVarint(buttons) || !reader.readVarint(length) ||
+                buttons > UINT16_MAX || length == 0)
+            {
+                return false;
+            }
+
+            covered += length;
+            if (covered > parsed.frameCount)
+            {
+                return false;
+            }
+
+            playerRuns.push_back({static_cast<uint16_t>(buttons), static_cast<uint32_t>(length)});
+        }
+
+        if (covered != parsed.frameCount)
+        {
+            return false;
+        }
+    }
+
+    header = parsed;
+    runs.swap(parsedRuns);
+    rewind();
+    return true;
+}
+
+std::vector<PlayerInput> ReplayPlayer::next()
+{
+    std::vector<PlayerInput> inputs(runs.size());
+
+    if (isFinished())
+    {
+        return inputs;
+    }
+
+    for (size_t i = 0; i < runs.size(); i++)
+    {
+        const ReplayRun& run = runs[i][runIndex[i]];
+        inputs[i].buttons = run.buttons;
+
+        // Move on to the next run once this one is used up
+        if (++runOffset[i] >= run.length)
+        {
+            runOffset[i] = 0;
+            runIndex[i]++;
+        }
+    }
+
+    frame++;
+    return inputs;
+}
+
+void ReplayPlayer::rewind()
+{
+    frame = 0;
+    runIndex.assign(runs.size(), 0);
+    runOffset.assign(runs.size(), 0);
+}
@@ -0,0 +1,216 @@
+#include "Snapshot.h"
+#include "World.h"
+#include "EnhancedAIController.h"
+
+namespace
+{
+    const char SNAPSHOT_MAGIC[4] = {'V', 'B', 'S', 'S'};
+    const uint8_t SNAPSHOT_VERSION = 8 | REAL_FORMAT_FLAG;
+
+    // Magic, version, total length, player count, AI slot mask, contents
+    const size_t SNAPSHOT_HEADER_SIZE = sizeof(SNAPSHOT_MAGIC) + 1 + 4 + 1 + 1 + 1;
+    const size_t SNAPSHOT_LENGTH_OFFSET = sizeof(SNAPSHOT_MAGIC) + 1;
+
+    // Bit i set when players[i] is AI driven
+    uint8_t aiMask(const World& world)
+    {
+        uint8_t mask = 0;
+        for (size_t i = 0; i < world.players.size() && i < 8; i++)
+        {
+            if (world.getAI(static_cast<int>(i)))
+            {
+                mask |= static_cast<uint8_t>(1 << i);
+            }
+        }
+        return mask;
+    }
+
+    // Characters point at each other only through grabs; store those as slot indices
+    int8_t indexOf(const std::vector<Character*>& players, const Character* character)
+    {
+        for (size_t i = 0; i < players.size(); i++)
+        {
+            if (players[i] == character)
+            {
+                return static_cast<int8_t>(i);
+            }
+        }
+        return -1;
+    }
+
+    void saveCharacter(SnapshotWriter& writer, const Character& character, const std::vector<Character*>& players)
+    {
+        writer.write(character.width);
+        writer.write(character.height);
+        writer.write(character.speed);
+        writer.write(character.color);
+
+        writer.write(character.physics);
+        writer.write(character.stateManager);
+
+        writer.write(character.damagePercent);
+        writer.write(character.stocks);
+
+        writer.write(character.currentFrame);
+        writer.write(character.framesCounter);
+        writer.write(character.framesSpeed);
+
+        writer.write(character.deathRotation);
+        writer.write(character.deathScale);
+        writer.write(character.deathVelocity);
+        writer.write(character.deathPosition);
+
+        writer.write(indexOf(players, character.grabbedCharacter));
+
+        writer.writeArray(character.attacks);
+    }
+
+    void restoreCharacter(SnapshotReader& reader, Character& character, const std::vector<Character*>& players)
+    {
+        reader.read(character.width);
+        reader.read(character.height);
+        reader.read(character.speed);
+        reader.read(character.color);
+
+        reader.read(character.physics);
+        reader.read(character.stateManager);
+
+        reader.read(character.damagePercent);
+        reader.read(character.stocks);
+
+        reader.read(character.currentFrame);
+        reader.read(character.framesCounter);
+        reader.read(character.framesSpeed);
+
+        reader.read(character.deathRotation);
+        reader.read(character.deathScale);
+        reader.read(character.deathVelocity);
+        reader.read(character.deathPosition);
+
+        int8_t grabbed;
+        reader.read(grabbed);
+        character.grabbedCharacter = grabbed >= 0 && grabbed < static_cast<int>(players.size()) ? players[grabbed] : nullptr;
+
+        reader.readArray(character.attacks);
+    }
+}
+
+namespace Snapshot {
+    void save(const World& world, std::vector<uint8_t>& buffer, Contents contents)
+    {
+        buffer.clear();
+        SnapshotWriter writer(buffer);
+
+        // Header; the length is patched in once the body is written
+        for (char c : SNAPSHOT_MAGIC)
+        {
+            writer.write(static_cast<uint8_t>(c));
+        }
+        writer.write(SNAPSHOT_VERSION);
+        writer.write(static_cast<uint32_t>(0));
+        writer.write(static_cast<uint8_t>(world.players.size()));
+        writer.write(aiMask(world));
+        writer.write(static_cast<uint8_t>(contents));
+
+        // Simulation clock and random streams
+        writer.write(world.frame);
+        writer.write(world.seed);
+        writer.write(world.random);
+        writer.writeArray(world.previousInputs);
+        writer.writeArray(world.stats);
+
+        // Stage: only moving platforms change
+        world.movingPlatforms.save(writer);
+
+        // Characters, in slot order
+        for (const Character* player : world.players)
+        {
+            saveCharacter(writer, *player, world.players);
+        }
+
+        world.projectiles.save(writer);
+        if (contents == WITH_EFFECTS)
+        {
+            world.vfx.save(writer);
+        }
+
+        for (const auto& controller : world.ai)
+        {
+            if (controller)
+            {
+                controller->SaveSnapshot(writer);
+            }
+        }
+
+        uint32_t length = static_cast<uint32_t>(buffer.size());
+        std::memcpy(buffer.data() + SNAPSHOT_LENGTH_OFFSET, &length, sizeof(length));
+    }
+
+    bool restore(World& world, const std::vector<uint8_t>& buffer)
+    {
+        SnapshotReader reader(buffer.data(), buffer.size());
+
+        // Validate the header before touching the world
+        for (char c : SNAPSHOT_MAGIC)
+        {
+            uint8_t byte;
+            if (!reader.read(byte) || byte != static_cast<uint8_t>(c))
+            {
+                return false;
+            }
+        }
+
+        uint8_t version;
+        uint32_t length;
+        uint8_t playerCount;
+        uint8_t aiSlots;
+        uint8_t contents;
+        reader.read(version);
+        reader.read(length);
+        reader.read(playerCount);
+        reader.read(aiSlots);
+        reader.read(contents);
+
+        if (reader.hasFailed() ||
+            version != SNAPSHOT_VERSION ||
+            length != buffer.size() ||
+            playerCount != world.players.size() ||
+            aiSlots != aiMask(world) ||
+            contents > SIMULATION_ONLY)
+        {
+            return false;
+        }
+
+        reader.read(world.frame);
+        reader.read(world.seed);
+        reader.read(world.random);
+        reader.readArray(world.previousInputs);
+        reader.readArray(world.stats);
+
+        if (!world.movingPlatforms.restore(reader, world.platforms))
+        {
+            return false;
+        }
+
+        for (Character* player : world.players)
+        {
+            restoreCharacter(reader, *player, world.players);
+        }
+
+        world.projectiles.restore(reader);
+        if (contents == WITH_EFFECTS)
+        {
+            world.vfx.restore(reader);
+        }
+
+        for (auto& controller : world.ai)
+        {
+            if (controller)
+            {
+                controller->RestoreSnapshot(reader);
+            }
+        }
+
+        return !reader.hasFailed() && reader.isAtEnd();
+    }
+}
@@ -0,0 +1,130 @@
+#include "StressScene.h"
+#include "World.h"
+#include "AIConfig.h"
+#include "GameConfig.h"
+#include <string>
+
+namespace
+{
+    // Enough that nobody runs out between top-ups
+    const int STRESS_STOCKS = 99;
+
+    // Moving platforms shuttle this far at this many units per tick
+    const int MIN_PATH_LENGTH = 80;
+    const int MAX_PATH_LENGTH = 300;
+    const int MIN_PLATFORM_SPEED = 1;
+    const int MAX_PLATFORM_SPEED = 6;
+
+    const Color STRESS_COLORS[] = {RED, BLUE, GREEN, ORANGE, PURPLE, GOLD, PINK, SKYBLUE, LIME, MAROON, VIOLET, BROWN};
+    const int STRESS_COLOR_COUNT = sizeof(STRESS_COLORS) / sizeof(STRESS_COLORS[0]);
+}
+
+void StressScene::build(World& world, const StressConfig& config)
+{
+    world.clear();
+    world.disableAI();
+    world.setSeed(config.seed);
+
+    // Layout comes from its own stream so it never shifts the match's random sequence
+    Random layout(config.seed ^ 0x5714E55ULL);
+
+    // Solid floor across the screen, so every character has somewhere to land
+    world.platforms.push_back(Platform(40, SCREEN_HEIGHT - 100, SCREEN_WIDTH - 80, 50, DARKGRAY, SOLID));
+
+    // Extra platforms scattered between the blast zones, overlaps allowed
+    int solidCount = static_cast<int>((config.platforms - 1) * config.solidFraction);
+    for (int i = 1; i < config.platforms; i++)
+    {
+        bool solid = i <= solidCount;
+        float width = static_cast<float>(layout.range(60, 220));
+        float height = solid ? static_cast<float>(layout.range(20, 40)) : 20.0f;
+        float x = static_cast<float>(layout.range(static_cast<int>(BLAST_ZONE_LEFT) + 50,
+                                                  static_cast<int>(BLAST_ZONE_RIGHT - width) - 50));
+        float y = static_cast<float>(layout.range(static_cast<int>(BLAST_ZONE_TOP) + 100, SCREEN_HEIGHT - 160));
+        world.platforms.push_back(Platform(x, y, width, height, solid ? DARKGRAY : GRAY, solid ? SOLID : PASSTHROUGH));
+    }
+
+    // The last passthrough platforms move, half side to side and half up and
+    // down, turning back rather than leaving the area platforms spawn in
+    int movingCount = static_cast<int>((config.platforms - 1 - solidCount) * config.movingFraction);
+    for (int i = config.platforms - movingCount; i < config.platforms; i++)
+    {
+        const Rectangle& rect = world.platforms[i].rect;
+        float length = static_cast<float>(layout.range(MIN_PATH_LENGTH, MAX_PATH_LENGTH));
+        float speed = static_cast<float>(layout.range(MIN_PLATFORM_SPEED, MAX_PLATFORM_SPEED));
+        Vector2 end = {rect.x, rect.y};
+        if (i % 2 == 0)
+        {
+            end.x = rect.x + length <= BLAST_ZONE_RIGHT - rect.width - 50 ? rect.x + length : rect.x - length;
+        }
+        else
+        {
+            end.y = rect.y - length >= BLAST_ZONE_TOP + 100 ? rect.y - length : rect.y + length;
+        }
+        world.movingPlatforms.add(i, world.platforms, end, speed);
+    }
+    world.rebuildPlatformGrid();
+
+    // Characters spread evenly along the floor, each fighting the next one round
+    float spacing = (SCREEN_WIDTH - 160.0f) / config.characters;
+    for (int i = 0; i < config.characters; i++)
+    {
+        Vector2 spawn = {80.0f + (i + 0.5f) * spacing, SCREEN_HEIGHT - 200.0f};
+        world.spawnPoints.push_back(spawn);
+
+        Character* character = new Character(
+            spawn.x, spawn.y,
+            50, 80,
+            5.0f,
+            STRESS_COLORS[i % STRESS_COLOR_COUNT],
+            "CPU " + std::to_string(i + 1)
+        );
+        character->stocks = STRESS_STOCKS;
+        world.addPlayer(character);
+    }
+
+    for (int i = 0; i < config.characters; i++)
+    {
+        world.enableAI(i, (i + 1) % config.characters, AIConfig(config.aiDifficulty));
+    }
+}
+
+void StressScene::drive(World& world, const StressConfig& config)
+{
+    int count = static_cast<int>(world.players.size());
+    if (count == 0)
+    {
+        return;
+    }
+
+    // Forced specials fire into the world's projectiles, as they would during a step
+    ProjectileScope projectileScope(world.projectiles);
+
+    for (int i = 0; i < count; i++)
+    {
+        Character* character = world.players[i];
+        if (character->stocks < 2)
+        {
+            character->stocks = STRESS_STOCKS;
+        }
+
+        // Staggered so the projectiles do not all spawn on the same tick. The
+        // cooldown is skipped, otherwise it caps spam at one shot per 2 seconds
+        if (config.projectileInterval > 0 && (world.frame + i) % config.projectileInterval == 0)
+        {
+            character->stateManager.specialNeutralCD.current = 0;
+            character->neutralSpecial();
+        }
+    }
+
+    // One character at a time crosses the explosion threshold; the regular
+    // damage check turns that into a full explosion on the next update
+    if (config.explosionInterval > 0 && world.frame % config.explosionInterval == 0)
+    {
+        Character* victim = world.players[(world.frame / config.explosionInterval) % count];
+        if (!victim->stateManager.isDying && !victim->stateManager.isExploding)
+        {
+            victim->damagePercent = EXPLOSION_DAMAGE_THRESHOLD;
+        }
+    }
+}
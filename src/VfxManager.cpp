@@ -0,0 +1,149 @@
+#include "VfxManager.h"
+#include "Cosmetics.h"
+#include "Snapshot.h"
+
+namespace {
+    // Small; only code running outside a world (benchmarks, tools) lands here
+    const int DEFAULT_PARTICLE_CAPACITY = 4096;
+
+    thread_local VfxManager* boundVfx = nullptr;
+
+    VfxManager& defaultVfx() {
+        thread_local VfxManager vfx(DEFAULT_PARTICLE_CAPACITY);
+        return vfx;
+    }
+}
+
+const float VfxManager::FLASH_SIZE = 20.0f;
+const float VfxManager::SHOCKWAVE_SPEED = 8.0f;
+
+VfxManager::VfxManager(int particleCapacity)
+    : particles(particleCapacity),
+      flashes(0), flashPosX(MAX_FLASHES), flashPosY(MAX_FLASHES), flashColor(MAX_FLASHES), flashFrame(MAX_FLASHES),
+      shockwaves(0), shockwavePosX(MAX_SHOCKWAVES), shockwavePosY(MAX_SHOCKWAVES),
+      shockwaveFrame(MAX_SHOCKWAVES), shockwaveDuration(MAX_SHOCKWAVES) {
+}
+
+bool VfxManager::addHitFlash(Vector2 position, Color color) {
+    if (!cosmeticsEnabled() || flashes >= MAX_FLASHES) {
+        return false;
+    }
+
+    int i = flashes++;
+    flashPosX[i] = position.x;
+    flashPosY[i] = position.y;
+    flashColor[i] = color;
+    flashFrame[i] = 0;
+    return true;
+}
+
+bool VfxManager::addShockwave(Vector2 position, int duration) {
+    if (!cosmeticsEnabled() || shockwaves >= MAX_SHOCKWAVES || duration <= 0) {
+        return false;
+    }
+
+    int i = shockwaves++;
+    shockwavePosX[i] = position.x;
+    shockwavePosY[i] = position.y;
+    shockwaveFrame[i] = 0;
+    shockwaveDuration[i] = duration;
+    return true;
+}
+
+void VfxManager::update() {
+    particles.update();
+
+    // Age and compact in the same pass; order is kept so overlapping flashes draw the same way every frame
+    int kept = 0;
+    for (int i = 0; i < flashes; i++) {
+        int frame = flashFrame[i] + 1;
+        if (frame < FLASH_DURATION) {
+            flashPosX[kept] = flashPosX[i];
+            flashPosY[kept] = flashPosY[i];
+            flashColor[kept] = flashColor[i];
+            flashFrame[kept] = frame;
+            kept++;
+        }
+    }
+    flashes = kept;
+
+    kept = 0;
+    for (int i = 0; i < shockwaves; i++) {
+        int frame = shockwaveFrame[i] + 1;
+        if (frame < shockwaveDuration[i]) {
+            shockwavePosX[kept] = shockwavePosX[i];
+            shockwavePosY[kept] = shockwavePosY[i];
+            shockwaveFrame[kept] = frame;
+            shockwaveDuration[kept] = shockwaveDuration[i];
+            kept++;
+        }
+    }
+    shockwaves = kept;
+}
+
+void VfxManager::clear() {
+    particles.clear();
+    flashes = 0;
+    shockwaves = 0;
+}
+
+void VfxManager::save(SnapshotWriter& writer) const {
+    particles.save(writer);
+
+    writer.write(static_cast<uint32_t>(flashes));
+    writer.writeSpan(flashPosX.data(), flashes);
+    writer.writeSpan(flashPosY.data(), flashes);
+    writer.writeSpan(flashColor.data(), flashes);
+    writer.writeSpan(flashFrame.data(), flashes);
+
+    writer.write(static_cast<uint32_t>(shockwaves));
+    writer.writeSpan(shockwavePosX.data(), shockwaves);
+    writer.writeSpan(shockwavePosY.data(), shockwaves);
+    writer.writeSpan(shockwaveFrame.data(), shockwaves);
+    writer.writeSpan(shockwaveDuration.data(), shockwaves);
+}
+
+bool VfxManager::restore(SnapshotReader& reader) {
+    bool restored = particles.restore(reader);
+
+    uint32_t savedFlashes;
+    if (!reader.read(savedFlashes) || savedFlashes > MAX_FLASHES) {
+        clear();
+        return false;
+    }
+    flashes = static_cast<int>(savedFlashes);
+    reader.readSpan(flashPosX.data(), flashes);
+    reader.readSpan(flashPosY.data(), flashes);
+    reader.readSpan(flashColor.data(), flashes);
+    reader.readSpan(flashFrame.data(), flashes);
+
+    uint32_t savedShockwaves;
+    if (!reader.read(savedShockwaves) || savedShockwaves > MAX_SHOCKWAVES) {
+        clear();
+        return false;
+    }
+    shockwaves = static_cast<int>(savedShockwaves);
+    reader.readSpan(shockwavePosX.data(), shockwaves);
+    reader.readSpan(shockwavePosY.data(), shockwaves);
+    reader.readSpan(shockwaveFrame.data(), shockwaves);
+    reader.readSpan(shockwaveDuration.data(), shockwaves);
+
+    if (!restored || reader.hasFailed()) {
+        clear();
+        return false;
+    }
+    return true;
+}
+
+VfxScope::VfxScope(VfxManager& vfx)
+    : previous(boundVfx) {
+    boundVfx = &vfx;
+}
+
+VfxScope::~VfxScope() {
+    boundVfx = previous;
+}
+
+VfxManager& currentVfx() {
+    return boundVfx ? *boundVfx : defaultVfx();
+}
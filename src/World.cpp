@@ -0,0 +1,769 @@
+#include "World.h"
+#include "EnhancedAIController.h"
+#include "GameConfig.h"
+#include "AIConfig.h"
+#include "Profiler.h"
+#include "Cosmetics.h"
+#include "ParticleEmitter.h"
+#include "StateHash.h"
+
+using CharacterState::IDLE;
+using CharacterState::RUNNING;
+using CharacterState::JUMPING;
+using CharacterState::FALLING;
+
+using InputButton::LEFT;
+using InputButton::RIGHT;
+using InputButton::UP;
+using InputButton::DOWN;
+using InputButton::ATTACK;
+using InputButton::SPECIAL;
+using InputButton::SMASH;
+using InputButton::SHIELD;
+using InputButton::GRAB;
+
+namespace
+{
+    void hashCooldown(StateHasher& hasher, const Cooldown& cooldown)
+    {
+        hasher.add(cooldown.duration);
+        hasher.add(cooldown.current);
+    }
+
+    void hashStateManager(StateHasher& hasher, const CharacterStateManager& state)
+    {
+        hasher.add(state.state);
+        hasher.add(state.isFacingRight);
+        hasher.add(state.isJumping);
+        hasher.add(state.hasDoubleJump);
+        hasher.add(state.isAttacking);
+        hasher.add(state.canAttack);
+        hasher.add(state.isShielding);
+        hasher.add(state.shieldHealth);
+        hasher.add(state.isDodging);
+        hasher.add(state.dodgeFrames);
+        hasher.add(state.isHitstun);
+        hasher.add(state.hitstunFrames);
+        hasher.add(state.isInvincible);
+        hasher.add(state.invincibilityFrames);
+        hasher.add(state.isGrabbing);
+        hasher.add(state.grabDuration);
+        hasher.add(state.grabFrame);
+        hasher.add(state.isDying);
+        hasher.add(state.isExploding);
+        hasher.add(state.deathFrame);
+        hasher.add(state.deathDuration);
+        hasher.add(state.explosionFrame);
+        hasher.add(state.explosionDuration);
+        hasher.add(state.currentAttack);
+        hasher.add(state.attackDuration);
+        hasher.add(state.attackFrame);
+        hashCooldown(hasher, state.specialNeutralCD);
+        hashCooldown(hasher, state.specialSideCD);
+        hashCooldown(hasher, state.specialUpCD);
+        hashCooldown(hasher, state.specialDownCD);
+        hashCooldown(hasher, state.dodgeCD);
+    }
+
+    void hashAttack(StateHasher& hasher, const AttackBox& attack)
+    {
+        hasher.add(attack.rect);
+        hasher.add(attack.damage);
+        hasher.add(attack.baseKnockback);
+        hasher.add(attack.knockbackScaling);
+        hasher.add(attack.knockbackAngle);
+        hasher.add(attack.hitLag);
+        hasher.add(attack.shieldStun);
+        hasher.add(attack.type);
+        hasher.add(attack.isActive);
+        hasher.add(attack.duration);
+        hasher.add(attack.currentFrame);
+        hasher.add(attack.velocity);
+        hasher.add(attack.destroyOnHit);
+    }
+
+    // The death animation's position, spin and scale are left out: only rendering reads them
+    void hashCharacter(StateHasher& hasher, const Character& character, int grabbedSlot)
+    {
+        hasher.add(character.width);
+        hasher.add(character.height);
+        hasher.add(character.speed);
+        hasher.add(character.physics.position);
+        hasher.add(character.physics.velocity);
+        hasher.add(character.physics.isFastFalling);
+        hasher.add(character.physics.ground);
+        hashStateManager(hasher, character.stateManager);
+        hasher.add(character.damagePercent);
+        hasher.add(character.stocks);
+        hasher.add(grabbedSlot);
+
+        hasher.add(static_cast<uint32_t>(character.attacks.size()));
+        for (const AttackBox& attack : character.attacks)
+        {
+            hashAttack(hasher, attack);
+        }
+    }
+}
+
+World::World()
+    : random(0), seed(0), frame(0)
+{
+    vfx.particles.setBudget(PARTICLE_BUDGET);
+
+    // Bake the explosion bursts now rather than during the first explosion
+    BurstTemplates::explosion();
+    BurstTemplates::massiveExplosion();
+}
+
+World::~World()
+{
+    clear();
+}
+
+void World::initDefaultStage()
+{
+    clear();
+
+    // Create platforms with appropriate types
+    // Main/bottom platform (SOLID - has full collision)
+    platforms.push_back(Platform(
+        SCREEN_WIDTH / 2 - 300, SCREEN_HEIGHT - 100,
+        600, 50,
+        DARKGRAY,
+        SOLID // Main platform is solid
+    ));
+
+    // Side platforms (PASSTHROUGH - only collide from top)
+    platforms.push_back(Platform(
+        SCREEN_WIDTH / 2 - 250, SCREEN_HEIGHT - 250,
+        150, 20,
+        GRAY,
+        PASSTHROUGH // Side platforms are passthrough
+    ));
+
+    platforms.push_back(Platform(
+        SCREEN_WIDTH / 2 + 100, SCREEN_HEIGHT - 250,
+        150, 20,
+        GRAY,
+        PASSTHROUGH // Side platforms are passthrough
+    ));
+
+    // Top platform (PASSTHROUGH)
+    platforms.push_back(Platform(
+        SCREEN_WIDTH / 2 - 75, SCREEN_HEIGHT - 400,
+        150, 20,
+        GRAY,
+        PASSTHROUGH // Top platform is passthrough
+    ));
+
+    rebuildPlatformGrid();
+
+    // Create spawn points
+    spawnPoints.push_back({SCREEN_WIDTH / 2 - 200, SCREEN_HEIGHT - 200});
+    spawnPoints.push_back({SCREEN_WIDTH / 2 + 200, SCREEN_HEIGHT - 200});
+    spawnPoints.push_back({SCREEN_WIDTH / 2, SCREEN_HEIGHT - 200});
+    spawnPoints.push_back({SCREEN_WIDTH / 2, SCREEN_HEIGHT - 300});
+
+    // Create player and enemy
+    addPlayer(new Character(
+        spawnPoints[0].x, spawnPoints[0].y,
+        50, 80,
+        5.0f,
+        RED,
+        "Player 1"
+    ));
+
+    addPlayer(new Character(
+        spawnPoints[1].x, spawnPoints[1].y,
+        50, 80,
+        5.0f,
+        BLUE,
+        "Enemy"
+    ));
+
+    previousInputs.assign(players.size(), PlayerInput());
+    stats.assign(players.size(), PlayerStats());
+}
+
+void World::addPlayer(Character* player)
+{
+    player->slot = static_cast<int>(players.size());
+    players.push_back(player);
+}
+
+bool World::initFromReplay(const ReplayHeader& header)
+{
+    if (header.stageId != REPLAY_STAGE_DEFAULT)
+    {
+        return false;
+    }
+
+    initDefaultStage();
+    setSeed(header.seed);
+
+    // Same placement as the match start countdown, so headless playback
+    // begins from the exact state the recording did
+    for (int i = 0; i < static_cast<int>(players.size()); i++)
+    {
+        players[i]->respawn(spawnPoints[i]);
+        players[i]->stocks = header.stockCount;
+    }
+
+    disableAI();
+    if (header.aiEnabled)
+    {
+        enableAI(header.aiDifficulty);
+    }
+
+    return true;
+}
+
+void World::addMovingPlatform(const Platform& platform, Vector2 end, float speed, bool looping)
+{
+    platforms.push_back(platform);
+    movingPlatforms.add(static_cast<int>(platforms.size()) - 1, platforms, end, speed, looping);
+}
+
+void World::rebuildPlatformGrid()
+{
+    std::vector<Rectangle> bounds;
+    bounds.reserve(platforms.size());
+    for (const Platform& platform : platforms)
+    {
+        bounds.push_back(platform.rect);
+    }
+    for (int i = 0; i < movingPlatforms.size(); i++)
+    {
+        bounds[movingPlatforms.platformIndex(i)] = movingPlatforms.pathBounds(i, platforms);
+    }
+    platformGrid.build(bounds);
+}
+
+void World::setSeed(uint64_t matchSeed)
+{
+    seed = matchSeed;
+    random.seed(matchSeed);
+}
+
+void World::enableAI(float difficulty)
+{
+    enableAI(AI_PLAYER_INDEX, 0, AIConfig(difficulty));
+}
+
+void World::enableAI(int slot, int opponentSlot, const AIConfig& config)
+{
+    if (static_cast<int>(ai.size()) <= slot)
+    {
+        ai.resize(slot + 1);
+    }
+
+    ai[slot] = std::make_unique<EnhancedAIController>();
+    ai[slot]->SetPlayerSlots(slot, opponentSlot);
+    ai[slot]->SetConfig(config);
+}
+
+void World::disableAI()
+{
+    ai.clear();
+}
+
+EnhancedAIController* World::getAI(int slot) const
+{
+    return slot >= 0 && slot < static_cast<int>(ai.size()) ? ai[slot].get() : nullptr;
+}
+
+void World::step(const std::vector<PlayerInput>& inputs)
+{
+    PROFILE_SCOPE("World::step");
+
+    // All randomness during the tick comes from this match's streams, and
+    // every effect and projectile characters create lands in this match
+    RandomScope randomScope(random);
+    VfxScope vfxScope(vfx);
+    ProjectileScope projectileScope(projectiles);
+
+    // Stock counts before the tick, to spot KOs afterwards
+    stats.resize(players.size());
+    std::vector<int> stocksBefore(players.size());
+    for (int i = 0; i < static_cast<int>(players.size()); i++)
+    {
+        stocksBefore[i] = players[i]->stocks;
+    }
+
+    if (platformGrid.size() != static_cast<int>(platforms.size()))
+    {
+        rebuildPlatformGrid();
+    }
+
+    // Platforms move first, so characters sweep against where they end the tick
+    updatePlatforms();
+    updatePlayers();
+    updateProjectiles();
+
+    // Find this tick's hits, then apply them
+    checkHits();
+    resolveHits();
+
+    // Update particles, hit flashes and shockwaves
+    updateEffects();
+
+    // Apply player inputs
+    applyInputs(inputs);
+
+    // Run the enhanced AI for each slot that has one
+    for (auto& controller : ai)
+    {
+        if (controller)
+        {
+            controller->Update(players, platforms);
+        }
+    }
+
+    updateStats(stocksBefore);
+
+    frame++;
+}
+
+bool World::isMatchOver() const
+{
+    int aliveCount = 0;
+
+    for (auto& player : players)
+    {
+        if (player->stocks > 0)
+        {
+            aliveCount++;
+        }
+    }
+
+    return aliveCount <= 1;
+}
+
+uint64_t World::stateHash() const
+{
+    StateHasher hasher;
+    hasher.add(frame);
+    for (uint32_t word : random.gameplay.state)
+    {
+        hasher.add(word);
+    }
+
+    movingPlatforms.hash(hasher);
+
+    hasher.add(static_cast<uint32_t>(players.size()));
+    for (const Character* player : players)
+    {
+        int grabbedSlot = player->grabbedCharacter ? player->grabbedCharacter->slot : -1;
+        hashCharacter(hasher, *player, grabbedSlot);
+    }
+
+    projectiles.hash(hasher);
+
+    for (const PlayerInput& input : previousInputs)
+    {
+        hasher.add(input.buttons);
+    }
+
+    for (const PlayerStats& playerStats : stats)
+    {
+        hasher.add(playerStats.falls);
+        hasher.add(playerStats.KOs);
+        hasher.add(playerStats.selfDestructs);
+        hasher.add(playerStats.damageDealt);
+        hasher.add(playerStats.damageTaken);
+        hasher.add(playerStats.lastHitBy);
+    }
+
+    return hasher.get();
+}
+
+void World::clear()
+{
+    // Free allocated memory
+    for (auto& player : players)
+    {
+        delete player;
+    }
+
+    players.clear();
+    platforms.clear();
+    platformGrid.clear();
+    movingPlatforms.clear();
+    spawnPoints.clear();
+    projectiles.clear();
+    vfx.clear();
+    hits.clear();
+    previousInputs.clear();
+    stats.clear();
+    frame = 0;
+}
+
+void World::updatePlatforms()
+{
+    PROFILE_SCOPE("platforms");
+
+    movingPlatforms.update(platforms);
+}
+
+void World::updatePlayers()
+{
+    PROFILE_SCOPE("Character::update");
+
+    // Physics for everyone, then one collision pass over all of them, then
+    // each character applies its own contact
+    collisions.clear();
+    sweeping.clear();
+    for (auto& player : players)
+    {
+        Vec2 move;
+        if (player->beginUpdate(move))
+        {
+            collisions.add(player->physics.position, player->width, player->height, move, player->physics.ground);
+            sweeping.push_back(player);
+        }
+    }
+
+    collisions.resolve(platforms, platformGrid);
+
+    for (int i = 0; i < static_cast<int>(sweeping.size()); i++)
+    {
+        sweeping[i]->finishUpdate(collisions.contact(i));
+    }
+}
+
+void World::updateProjectiles()
+{
+    PROFILE_SCOPE("projectiles");
+
+    projectiles.update();
+}
+
+void World::checkHits()
+{
+    PROFILE_SCOPE("checkHit");
+
+    // Gather every live hitbox and hurtbox; only the pairs whose boxes overlap are tested further
+    broadphase.clear();
+    for (int slot = 0; slot < static_cast<int>(players.size()); slot++)
+    {
+        Character* player = players[slot];
+        if (player->stateManager.isDying || player->stateManager.isExploding)
+        {
+            continue;
+        }
+
+        if (player->stateManager.isAttacking)
+        {
+            for (int attack = 0; attack < static_cast<int>(player->attacks.size()); attack++)
+            {
+                if (player->attacks[attack].isActive)
+                {
+                    broadphase.addHitbox(slot, attack, player->attacks[attack].rect);
+                }
+            }
+        }
+
+        if (!player->stateManager.isInvincible)
+        {
+            broadphase.addHurtbox(slot, player->getHurtbox());
+        }
+    }
+
+    // Projectiles hit whatever their owner is doing
+    for (int i = 0; i < projectiles.size(); i++)
+    {
+        broadphase.addProjectile(projectiles.owners()[i], i, projectiles.rect(i));
+    }
+
+    hits.clear();
+    const std::vector<HitCandidate>& candidates = broadphase.findPairs();
+    detectHits(players, projectiles, candidates, 0, candidates.size(), hits);
+}
+
+void World::resolveHits()
+{
+    PROFILE_SCOPE("resolveHits");
+
+    // Events are in attacker, victim, hitbox order. Earlier hits can use up a
+    // projectile or end an attack, which drops the events that come after.
+    size_t resolved = 0;
+    for (size_t i = 0; i < hits.size(); i++)
+    {
+        const HitEvent& hit = hits[i];
+        Character* attacker = players[hit.attacker];
+        Character* victim = players[hit.victim];
+
+        Real damageBefore = victim->damagePercent;
+        bool damaged;
+        if (hit.type == AttackBox::PROJECTILE)
+        {
+            if (projectiles.isSpent(hit.hitbox))
+            {
+                continue;
+            }
+
+            AttackBox projectile = projectiles.attackBox(hit.hitbox);
+            damaged = attacker->applyHit(projectile, *victim);
+            if (!projectile.isActive)
+            {
+                projectiles.expire(hit.hitbox);
+            }
+        }
+        else
+        {
+            AttackBox& attack = attacker->attacks[hit.hitbox];
+            if (!attacker->stateManager.isAttacking || !attack.isActive)
+            {
+                continue;
+            }
+
+            damaged = attacker->applyHit(attack, *victim);
+        }
+
+        if (damaged)
+        {
+            vfx.addHitFlash(hit.point, attacker->color);
+        }
+
+        // Credit the damage and remember who to award a KO to
+        Real dealt = victim->damagePercent - damageBefore;
+        stats[hit.attacker].damageDealt += dealt;
+        stats[hit.victim].damageTaken += dealt;
+        stats[hit.victim].lastHitBy = hit.attacker;
+
+        for (auto& controller : ai)
+        {
+            if (controller)
+            {
+                controller->OnHit(hit);
+            }
+        }
+
+        hits[resolved++] = hit;
+    }
+    hits.resize(resolved);
+
+    // Spent projectiles stay in place while events refer to them by index
+    projectiles.removeSpent();
+}
+
+void World::updateEffects()
+{
+    PROFILE_SCOPE("vfx");
+
+    // Rollback re-simulates frames whose effects have already played
+    if (!cosmeticsEnabled())
+    {
+        return;
+    }
+
+    vfx.update();
+}
+
+void World::applyInputs(const std::vector<PlayerInput>& inputs)
+{
+    PROFILE_SCOPE("input");
+
+    previousInputs.resize(players.size());
+    for (int i = 0; i < static_cast<int>(players.size()); i++)
+    {
+        // AI slots ignore inputs
+        if (getAI(i))
+        {
+            continue;
+        }
+
+        PlayerInput input = i < static_cast<int>(inputs.size()) ? inputs[i] : PlayerInput();
+        applyInput(players[i], input, previousInputs[i]);
+        previousInputs[i] = input;
+    }
+}
+
+void World::updateStats(const std::vector<int>& stocksBefore)
+{
+    for (int i = 0; i < static_cast<int>(players.size()); i++)
+    {
+        int lost = stocksBefore[i] - players[i]->stocks;
+        if (lost <= 0)
+        {
+            continue;
+        }
+
+        // Whoever hit this player last during the stock gets the KO
+        PlayerStats& victim = stats[i];
+        victim.falls += lost;
+        if (victim.lastHitBy >= 0)
+        {
+            stats[victim.lastHitBy].KOs += lost;
+        }
+        else
+        {
+            victim.selfDestructs += lost;
+        }
+        victim.lastHitBy = -1;
+    }
+}
+
+void World::applyInput(Character* player, const PlayerInput& input, const PlayerInput& previous)
+{
+    if (player->stocks <= 0 || player->stateManager.isDying)
+    {
+        return;
+    }
+
+    // Movement
+    if (input.isDown(LEFT)) player->moveLeft();
+    if (input.isDown(RIGHT)) player->moveRight();
+    if (input.isPressed(UP, previous)) player->jump();
+
+    // Fast fall / platform drop-through
+    if (input.isDown(DOWN))
+    {
+        if (player->stateManager.state == IDLE || player->stateManager.state == RUNNING)
+        {
+            // On ground, attempt to drop through platform
+            player->dropThroughPlatform();
+        }
+        else if (player->stateManager.state == FALLING)
+        {
+            // In air, fast fall
+            player->fastFall();
+        }
+    }
+
+    // Attacks
+    if (input.isPressed(ATTACK, previous))
+    {
+        // Basic attack - context sensitive
+        if (player->stateManager.state == JUMPING || player->stateManager.state == FALLING)
+        {
+            player->neutralAir();
+        }
+        else
+        {
+            player->jab();
+        }
+    }
+
+    if (input.isPressed(SPECIAL, previous))
+    {
+        // Special attack - context sensitive
+        if (input.isDown(LEFT) || input.isDown(RIGHT))
+        {
+            player->sideSpecial();
+        }
+        else if (input.isDown(UP))
+        {
+            player->upSpecial();
+        }
+        else if (input.isDown(DOWN))
+        {
+            player->downSpecial();
+        }
+        else
+        {
+            player->neutralSpecial();
+        }
+    }
+
+    // Smash attacks
+    if (input.isDown(SMASH))
+    {
+        if (input.isDown(LEFT) || input.isDown(RIGHT))
+        {
+            player->forwardSmash(20.0f);
+        }
+        else if (input.isDown(UP))
+        {
+            player->upSmash(20.0f);
+        }
+        else if (input.isDown(DOWN))
+        {
+            player->downSmash(20.0f);
+        }
+    }
+
+    // Shield/Dodge
+    if (input.isDown(SHIELD))
+    {
+        if (input.isPressed(LEFT, previous))
+        {
+            player->forwardDodge();
+        }
+        else if (input.isPressed(RIGHT, previous))
+        {
+            player->backDodge();
+        }
+        else if (input.isPressed(DOWN, previous))
+        {
+            player->spotDodge();
+        }
+        else
+        {
+            player->shield();
+        }
+    }
+    else if (input.isReleased(SHIELD, previous))
+    {
+        player->releaseShield();
+    }
+
+    // Grab
+    if (input.isPressed(GRAB, previous))
+    {
+        player->grab();
+    }
+
+    // Throws (when grabbing)
+    if (player->stateManager.isGrabbing)
+    {
+        if (input.isPressed(ATTACK, previous))
+        {
+            player->pummel();
+        }
+        else if (input.isPressed(LEFT, previous))
+        {
+            player->backThrow();
+        }
+        else if (input.isPressed(RIGHT, previous))
+        {
+            player->forwardThrow();
+        }
+        else if (input.isPressed(UP, previous))
+        {
+            player->upThrow();
+        }
+        else if (input.isPressed(DOWN, previous))
+        {
+            player->downThrow();
+        }
+    }
+
+    // Aerial controls - more specific aerial attacks
+    if (player->stateManager.state == JUMPING || player->stateManager.state == FALLING)
+    {
+        if (input.isPressed(ATTACK, previous))
+        {
+            if (input.isDown(LEFT))
+            {
+                player->backAir();
+            }
+            else if (input.isDown(RIGHT))
+            {
+                player->forwardAir();
+            }
+            else if (input.isDown(UP))
+            {
+                player->upAir();
+            }
+            else if (input.isDown(DOWN))
+            {
+                player->downAir();
+            }
+            else
+            {
+                player->neutralAir();
+            }
+        }
+    }
+}
@@ -23,11 +23,11 @@ void executeNeutralAir(Character* character) {
         character->stateManager.changeState(ATTACKING);
 
         // Create circular hitbox around character
-        float hitboxSize = character->width * 1.2f;
-        float hitboxX = character->physics.position.x - hitboxSize / 2;
-        float hitboxY = character->physics.position.y - hitboxSize / 2;
+        Real hitboxSize = Real(character->width) * Real(1.2f);
+        Real hitboxX = character->physics.position.x - realHalf(hitboxSize);
+        Real hitboxY = character->physics.position.y - realHalf(hitboxSize);
 
-        Rectangle hitboxRect = {hitboxX, hitboxY, hitboxSize, hitboxSize};
+        Rect hitboxRect = {hitboxX, hitboxY, hitboxSize, hitboxSize};
         character->attacks.push_back(AttackBox(hitboxRect, 8.0f, 3.0f, 0.1f, 45.0f, 8, 8));
     }
 }
@@ -43,14 +43,14 @@ void executeForwardAir(Character* character) {
         character->stateManager.changeState(ATTACKING);
 
         // Create forward air hitbox
-        float hitboxWidth = character->width * 0.9f;
-        float hitboxHeight = character->height * 0.5f;
-        float hitboxX = character->stateManager.isFacingRight
+        Real hitboxWidth = Real(character->width) * Real(0.9f);
+        Real hitboxHeight = Real(character->height) * Real(0.5f);
+        Real hitboxX = character->stateManager.isFacingRight
                         ? character->physics.position.x + character->width / 2
                         : character->physics.position.x - character->width / 2 - hitboxWidth;
-        float hitboxY = character->physics.position.y - hitboxHeight / 2;
+        Real hitboxY = character->physics.position.y - realHalf(hitboxHeight);
 
-        Rectangle hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
+        Rect hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
         character->attacks.push_back(AttackBox(hitboxRect, 9.0f, 4.0f, 0.15f, 
                                     character->stateManager.isFacingRight ? 45.0f : 135.0f, 12, 12));
     }
@@ -67,14 +67,14 @@ void executeBackAir(Character* character) {
         character->stateManager.changeState(ATTACKING);
 
         // Create back air hitbox
-        float hitboxWidth = character->width * 0.9f;
-        float hitboxHeight = character->height * 0.5f;
-        float hitboxX = character->stateManager.isFacingRight
+        Real hitboxWidth = Real(character->width) * Real(0.9f);
+        Real hitboxHeight = Real(character->height) * Real(0.5f);
+        Real hitboxX = character->stateManager.isFacingRight
                         ? character->physics.position.x - character->width / 2 - hitboxWidth
                         : character->physics.position.x + character->width / 2;
-        float hitboxY = character->physics.position.y - hitboxHeight / 2;
+        Real hitboxY = character->physics.position.y - realHalf(hitboxHeight);
 
-        Rectangle hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
+        Rect hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
         character->attacks.push_back(AttackBox(hitboxRect, 10.0f, 5.0f, 0.2f, 
                                     character->stateManager.isFacingRight ? 135.0f : 45.0f, 15, 15));
     }
@@ -91,12 +91,12 @@ void executeUpAir(Character* character) {
         character->stateManager.changeState(ATTACKING);
 
         // Create up air hitbox
-        float hitboxWidth = character->width * 0.8f;
-        float hitboxHeight = character->height * 0.7f;
-        float hitboxX = character->physics.position.x - hitboxWidth / 2;
-        float hitboxY = character->physics.position.y - character->height / 2 - hitboxHeight;
+        Real hitboxWidth = Real(character->width) * Real(0.8f);
+        Real hitboxHeight = Real(character->height) * Real(0.7f);
+        Real hitboxX = character->physics.position.x - realHalf(hitboxWidth);
+        Real hitboxY = character->physics.position.y - character->height / 2 - hitboxHeight;
 
-        Rectangle hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
+        Rect hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
         character->attacks.push_back(AttackBox(hitboxRect, 7.0f, 3.5f, 0.15f, 80.0f, 10, 10));
     }
 }
@@ -112,12 +112,12 @@ void executeDownAir(Character* character) {
         character->stateManager.changeState(ATTACKING);
 
         // Create down air hitbox
-        float hitboxWidth = character->width * 0.6f;
-        float hitboxHeight = character->height * 0.8f;
-        float hitboxX = character->physics.position.x - hitboxWidth / 2;
-        float hitboxY = character->physics.position.y + character->height / 2;
+        Real hitboxWidth = Real(character->width) * Real(0.6f);
+        Real hitboxHeight = Real(character->height) * Real(0.8f);
+        Real hitboxX = character->physics.position.x - realHalf(hitboxWidth);
+        Real hitboxY = character->physics.position.y + character->height / 2;
 
-        Rectangle hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
+        Rect hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
         character->attacks.push_back(AttackBox(hitboxRect, 10.0f, 5.0f, 0.2f, 270.0f, 15, 15));
     }
 }
@@ -1,11 +1,11 @@
 #include "../../include/attacks/AttackBox.h"
 
 AttackBox::AttackBox(
-    Rectangle r, 
-    float dmg, 
-    float baseKb, 
-    float kbScaling, 
-    float kbAngle, 
+    Rect r, 
+    Real dmg, 
+    Real baseKb, 
+    Real kbScaling, 
+    Real kbAngle, 
     int lag, 
     int shield
 ) 
@@ -20,20 +20,20 @@ AttackBox::AttackBox(
       isActive(true),
       duration(10),
       currentFrame(0),
-      velocity({0, 0}),
+      velocity{0, 0},
       destroyOnHit(false)
 {
 }
 
 AttackBox::AttackBox(
-    Rectangle r, 
-    float dmg, 
-    float baseKb, 
-    float kbScaling, 
-    float kbAngle, 
+    Rect r, 
+    Real dmg, 
+    Real baseKb, 
+    Real kbScaling, 
+    Real kbAngle, 
     int lag, 
     int dur,
-    Vector2 vel, 
+    Vec2 vel, 
     bool destroy
 ) 
     : rect(r),
@@ -68,22 +68,4 @@ bool AttackBox::update()
     }
 
     return true;
-}
-
-void AttackBox::draw(bool debug)
-{
-    if (debug && isActive) {
-        // Draw hitbox visualization in debug mode
-        Color hitboxColor = {255, 0, 0, 128};
-        
-        // Different colors for different hitbox types
-        if (type == GRAB) {
-            hitboxColor = {0, 0, 255, 128}; // Blue for grabs
-        } else if (type == PROJECTILE) {
-            hitboxColor = {255, 255, 0, 128}; // Yellow for projectiles
-        }
-        
-        DrawRectangleRec(rect, hitboxColor);
-        DrawRectangleLinesEx(rect, 1.0f, RED);
-    }
 }
\ No newline at end of file
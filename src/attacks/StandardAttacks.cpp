@@ -27,14 +27,14 @@ void executeJab(Character* character) {
         character->stateManager.changeState(ATTACKING);
 
         // Small hitbox with minimal knockback
-        float hitboxWidth = character->width * 0.7f;
-        float hitboxHeight = character->height * 0.5f;
-        float hitboxX = character->stateManager.isFacingRight
+        Real hitboxWidth = Real(character->width) * Real(0.7f);
+        Real hitboxHeight = Real(character->height) * Real(0.5f);
+        Real hitboxX = character->stateManager.isFacingRight
                         ? character->physics.position.x + character->width / 2
                         : character->physics.position.x - character->width / 2 - hitboxWidth;
-        float hitboxY = character->physics.position.y - hitboxHeight / 2;
+        Real hitboxY = character->physics.position.y - realHalf(hitboxHeight);
 
-        Rectangle hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
+        Rect hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
         character->attacks.push_back(AttackBox(hitboxRect, 3.0f, 1.5f, 0.05f, 
                                      character->stateManager.isFacingRight ? 0.0f : 180.0f, 5, 5));
 
@@ -55,14 +55,14 @@ void executeForwardTilt(Character* character) {
         character->stateManager.changeState(ATTACKING);
 
         // Create forward tilt hitbox
-        float hitboxWidth = character->width * 0.8f;
-        float hitboxHeight = character->height * 0.4f;
-        float hitboxX = character->stateManager.isFacingRight
+        Real hitboxWidth = Real(character->width) * Real(0.8f);
+        Real hitboxHeight = Real(character->height) * Real(0.4f);
+        Real hitboxX = character->stateManager.isFacingRight
                         ? character->physics.position.x + character->width / 2
                         : character->physics.position.x - character->width / 2 - hitboxWidth;
-        float hitboxY = character->physics.position.y - character->height * 0.1f;
+        Real hitboxY = character->physics.position.y - Real(character->height) * Real(0.1f);
 
-        Rectangle hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
+        Rect hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
         character->attacks.push_back(AttackBox(hitboxRect, 6.0f, 3.5f, 0.1f, 
                                     character->stateManager.isFacingRight ? 30.0f : 150.0f, 8, 8));
     }
@@ -80,12 +80,12 @@ void executeUpTilt(Character* character) {
         character->stateManager.changeState(ATTACKING);
 
         // Create up tilt hitbox
-        float hitboxWidth = character->width * 0.7f;
-        float hitboxHeight = character->height * 0.8f;
-        float hitboxX = character->physics.position.x - hitboxWidth / 2;
-        float hitboxY = character->physics.position.y - character->height / 2 - hitboxHeight / 2;
+        Real hitboxWidth = Real(character->width) * Real(0.7f);
+        Real hitboxHeight = Real(character->height) * Real(0.8f);
+        Real hitboxX = character->physics.position.x - realHalf(hitboxWidth);
+        Real hitboxY = character->physics.position.y - character->height / 2 - realHalf(hitboxHeight);
 
-        Rectangle hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
+        Rect hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
         character->attacks.push_back(AttackBox(hitboxRect, 5.0f, 2.0f, 0.12f, 80.0f, 8, 8));
     }
 }
@@ -102,14 +102,14 @@ void executeDownTilt(Character* character) {
         character->stateManager.changeState(ATTACKING);
 
         // Create down tilt hitbox
-        float hitboxWidth = character->width * 1.0f;
-        float hitboxHeight = character->height * 0.3f;
-        float hitboxX = character->stateManager.isFacingRight
+        Real hitboxWidth = Real(character->width) * Real(1.0f);
+        Real hitboxHeight = Real(character->height) * Real(0.3f);
+        Real hitboxX = character->stateManager.isFacingRight
                         ? character->physics.position.x + character->width / 4
                         : character->physics.position.x - character->width / 4 - hitboxWidth;
-        float hitboxY = character->physics.position.y + character->height / 2 - hitboxHeight;
+        Real hitboxY = character->physics.position.y + character->height / 2 - hitboxHeight;
 
-        Rectangle hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
+        Rect hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
         character->attacks.push_back(AttackBox(hitboxRect, 5.0f, 1.5f, 0.08f, 0.0f, 5, 5));
     }
 }
@@ -127,14 +127,14 @@ void executeDashAttack(Character* character) {
                                        character->speed * 1.5f : -character->speed * 1.5f;
 
         // Create dash attack hitbox
-        float hitboxWidth = character->width * 1.0f;
-        float hitboxHeight = character->height * 0.6f;
-        float hitboxX = character->stateManager.isFacingRight
+        Real hitboxWidth = Real(character->width) * Real(1.0f);
+        Real hitboxHeight = Real(character->height) * Real(0.6f);
+        Real hitboxX = character->stateManager.isFacingRight
                         ? character->physics.position.x + character->width / 2
                         : character->physics.position.x - character->width / 2 - hitboxWidth;
-        float hitboxY = character->physics.position.y - hitboxHeight / 2;
+        Real hitboxY = character->physics.position.y - realHalf(hitboxHeight);
 
-        Rectangle hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
+        Rect hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
         character->attacks.push_back(AttackBox(hitboxRect, 7.0f, 4.0f, 0.15f, 
                                     character->stateManager.isFacingRight ? 30.0f : 150.0f, 10, 10));
     }
@@ -153,23 +153,23 @@ void executeForwardSmash(Character* character, float chargeTime) {
         character->stateManager.changeState(ATTACKING);
 
         // Charge multiplier (1.0 to 1.5)
-        float chargeMultiplier = 1.0f + (chargeTime / 60.0f) * 0.5f;
-        if (chargeMultiplier > 1.5f) chargeMultiplier = 1.5f;
+        Real chargeMultiplier = Real(1.0f) + (Real(chargeTime) / Real(60.0f)) * Real(0.5f);
+        if (chargeMultiplier > Real(1.5f)) chargeMultiplier = 1.5f;
 
         // Create forward smash hitbox
-        float hitboxWidth = character->width * 1.2f;
-        float hitboxHeight = character->height * 0.6f;
-        float hitboxX = character->stateManager.isFacingRight
+        Real hitboxWidth = Real(character->width) * Real(1.2f);
+        Real hitboxHeight = Real(character->height) * Real(0.6f);
+        Real hitboxX = character->stateManager.isFacingRight
                         ? character->physics.position.x + character->width / 2
                         : character->physics.position.x - character->width / 2 - hitboxWidth;
-        float hitboxY = character->physics.position.y - hitboxHeight / 2;
+        Real hitboxY = character->physics.position.y - realHalf(hitboxHeight);
 
-        Rectangle hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
+        Rect hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
         character->attacks.push_back(AttackBox(
             hitboxRect,
-            12.0f * chargeMultiplier,
-            6.0f * chargeMultiplier,
-            0.25f * chargeMultiplier,
+            Real(12.0f) * chargeMultiplier,
+            Real(6.0f) * chargeMultiplier,
+            Real(0.25f) * chargeMultiplier,
             character->stateManager.isFacingRight ? 30.0f : 150.0f,
             15,
             15
@@ -189,21 +189,21 @@ void executeUpSmash(Character* character, float chargeTime) {
         character->stateManager.changeState(ATTACKING);
 
         // Charge multiplier (1.0 to 1.5)
-        float chargeMultiplier = 1.0f + (chargeTime / 60.0f) * 0.5f;
-        if (chargeMultiplier > 1.5f) chargeMultiplier = 1.5f;
+        Real chargeMultiplier = Real(1.0f) + (Real(chargeTime) / Real(60.0f)) * Real(0.5f);
+        if (chargeMultiplier > Real(1.5f)) chargeMultiplier = 1.5f;
 
         // Create up smash hitbox
-        float hitboxWidth = character->width * 0.8f;
-        float hitboxHeight = character->height * 1.2f;
-        float hitboxX = character->physics.position.x - hitboxWidth / 2;
-        float hitboxY = character->physics.position.y - character->height / 2 - hitboxHeight / 2;
+        Real hitboxWidth = Real(character->width) * Real(0.8f);
+        Real hitboxHeight = Real(character->height) * Real(1.2f);
+        Real hitboxX = character->physics.position.x - realHalf(hitboxWidth);
+        Real hitboxY = character->physics.position.y - character->height / 2 - realHalf(hitboxHeight);
 
-        Rectangle hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
+        Rect hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
         character->attacks.push_back(AttackBox(
             hitboxRect,
-            13.0f * chargeMultiplier,
-            7.0f * chargeMultiplier,
-            0.2f * chargeMultiplier,
+            Real(13.0f) * chargeMultiplier,
+            Real(7.0f) * chargeMultiplier,
+            Real(0.2f) * chargeMultiplier,
             90.0f,
             15,
             15
@@ -223,27 +223,27 @@ void executeDownSmash(Character* character, float chargeTime) {
         character->stateManager.changeState(ATTACKING);
 
         // Charge multiplier (1.0 to 1.5)
-        float chargeMultiplier = 1.0f + (chargeTime / 60.0f) * 0.5f;
-        if (chargeMultiplier > 1.5f) chargeMultiplier = 1.5f;
+        Real chargeMultiplier = Real(1.0f) + (Real(chargeTime) / Real(60.0f)) * Real(0.5f);
+        if (chargeMultiplier > Real(1.5f)) chargeMultiplier = 1.5f;
 
         // Create two hitboxes, one on each side
-        float hitboxWidth = character->width * 0.8f;
-        float hitboxHeight = character->height * 0.4f;
+        Real hitboxWidth = Real(character->width) * Real(0.8f);
+        Real hitboxHeight = Real(character->height) * Real(0.4f);
         
         // Left hitbox
-        float leftHitboxX = character->physics.position.x - character->width / 2 - hitboxWidth;
-        float hitboxY = character->physics.position.y + character->height / 2 - hitboxHeight;
-        Rectangle leftHitboxRect = {leftHitboxX, hitboxY, hitboxWidth, hitboxHeight};
+        Real leftHitboxX = character->physics.position.x - character->width / 2 - hitboxWidth;
+        Real hitboxY = character->physics.position.y + character->height / 2 - hitboxHeight;
+        Rect leftHitboxRect = {leftHitboxX, hitboxY, hitboxWidth, hitboxHeight};
         
         // Right hitbox
-        float rightHitboxX = character->physics.position.x + character->width / 2;
-        Rectangle rightHitboxRect = {rightHitboxX, hitboxY, hitboxWidth, hitboxHeight};
+        Real rightHitboxX = character->physics.position.x + character->width / 2;
+        Rect rightHitboxRect = {rightHitboxX, hitboxY, hitboxWidth, hitboxHeight};
 
         character->attacks.push_back(AttackBox(
             leftHitboxRect,
-            11.0f * chargeMultiplier,
-            5.5f * chargeMultiplier,
-            0.2f * chargeMultiplier,
+            Real(11.0f) * chargeMultiplier,
+            Real(5.5f) * chargeMultiplier,
+            Real(0.2f) * chargeMultiplier,
             20.0f,
             15,
             15
@@ -251,9 +251,9 @@ void executeDownSmash(Character* character, float chargeTime) {
         
         character->attacks.push_back(AttackBox(
             rightHitboxRect,
-            11.0f * chargeMultiplier,
-            5.5f * chargeMultiplier,
-            0.2f * chargeMultiplier,
+            Real(11.0f) * chargeMultiplier,
+            Real(5.5f) * chargeMultiplier,
+            Real(0.2f) * chargeMultiplier,
             160.0f,
             15,
             15
@@ -4,6 +4,12 @@
 #include "../../include/attacks/StandardAttacks.h"
 #include "../../include/attacks/AerialAttacks.h"
 #include "../../include/GameConfig.h"
+#include "../../include/Collision.h"
+#include "../../include/HitEvent.h"
+#include "../../include/ProjectilePool.h"
+#include "../../include/Random.h"
+#include "../../include/VfxManager.h"
+#include "../../include/ParticleEmitter.h"
 
 using CharacterState::State;
 using CharacterState::IDLE;
@@ -42,6 +48,13 @@ using AttackType::BACK_THROW;
 using AttackType::UP_THROW;
 using AttackType::DOWN_THROW;
 
+namespace
+{
+    // Neutral special projectile: 720 px of travel
+    const float PROJECTILE_SPEED = 24.0f;
+    const int PROJECTILE_LIFETIME = 30;
+}
+
 // Main constructor
 Character::Character(float x, float y, float w, float h, float spd, Color col, std::string n)
 {
@@ -67,6 +80,9 @@ Character::Character(float x, float y, float w, float h, float spd, Color col, s
     // Grab state
     grabbedCharacter = nullptr;
 
+    // Not in a world yet
+    slot = -1;
+
     // Death animation
     deathRotation = 0;
     deathScale = 1.0f;
@@ -75,19 +91,19 @@ Character::Character(float x, float y, float w, float h, float spd, Color col, s
 }
 
 // Basic geometry methods
-Rectangle Character::getRect()
+Rect Character::getRect() const
 {
     return {physics.position.x - width / 2, physics.position.y - height / 2, width, height};
 }
 
-Rectangle Character::getHurtbox()
+Rect Character::getHurtbox() const
 {
     // Hurtbox is slightly smaller than visual character size
-    float hurtboxScale = 0.85f;
-    float adjustedWidth = width * hurtboxScale;
-    float adjustedHeight = height * hurtboxScale;
+    Real hurtboxScale = 0.85f;
+    Real adjustedWidth = Real(width) * hurtboxScale;
+    Real adjustedHeight = Real(height) * hurtboxScale;
     return {
-        physics.position.x - adjustedWidth / 2, physics.position.y - adjustedHeight / 2,
+        physics.position.x - realHalf(adjustedWidth), physics.position.y - realHalf(adjustedHeight),
         adjustedWidth, adjustedHeight
     };
 }
@@ -114,10 +130,10 @@ void Character::resetAttackState()
 // Modify Character::isOutOfBounds() to differentiate between falling and other bounds
 bool Character::isOutOfBounds()
 {
-    return physics.position.x < GameConfig::BLAST_ZONE_LEFT ||
-        physics.position.x > GameConfig::BLAST_ZONE_RIGHT ||
-        physics.position.y < GameConfig::BLAST_ZONE_TOP ||
-        physics.position.y > GameConfig::BLAST_ZONE_BOTTOM;
+    return physics.position.x < Real(GameConfig::BLAST_ZONE_LEFT) ||
+        physics.position.x > Real(GameConfig::BLAST_ZONE_RIGHT) ||
+        physics.position.y < Real(GameConfig::BLAST_ZONE_TOP) ||
+        physics.position.y > Real(GameConfig::BLAST_ZONE_BOTTOM);
 }
 
 // Accessor methods
@@ -136,9 +152,21 @@ std::string Character::getName() const
     return name;
 }
 
-// Main update method with physics and collision handling
-void Character::update(std::vector<Platform>& platforms)
+// Main update method: physics, a sweep through the platforms, then the state that follows from it
+void Character::update(std::vector<Platform>& platforms, const PlatformGrid& grid)
 {
+    Vec2 move;
+    if (beginUpdate(move))
+    {
+        finishUpdate(sweepPlatforms(physics.position, width, height, move, platforms, grid, physics.ground));
+    }
+}
+
+bool Character::beginUpdate(Vec2& move)
+{
+    // Start of a new tick for render interpolation
+    physics.beginTick();
+
     // Check for explosion threshold first
     checkForExplosion();
 
@@ -152,28 +180,73 @@ void Character::update(std::vector<Platform>& platforms)
     if (stateManager.isExploding)
     {
         updateExplosionAnimation();
-        return;
+        return false;
     }
 
     // Skip updates if dying
     if (stateManager.isDying)
     {
         updateDeathAnimation(); // Original death animation
-        return;
+        return false;
     }
     // Update cooldowns and timers
     stateManager.updateCooldowns();
     stateManager.updateTimers();
 
+    // This tick's movement; gravity applied below only moves the character from the next tick
+    move = physics.velocity;
+
     // Apply appropriate physics based on state
-    bool onGround = false;
+    switch (stateManager.state)
+    {
+    case IDLE:
+    case RUNNING:
+    case JUMPING:
+    case FALLING:
+    case HITSTUN:
+        physics.applyGravity();
+        break;
+
+    case ATTACKING:
+        // Apply gravity during attacks
+        physics.applyGravity();
+
+        // Limited horizontal movement during attacks
+        move.x = realHalf(physics.velocity.x);
+        move.y = physics.velocity.y;
+        break;
+
+    case SHIELDING:
+        // No movement while shielding
+        physics.velocity.x = 0;
+        physics.velocity.y = 0;
+        move = {0, 0};
+        break;
+
+    case DODGING:
+        // Apply reduced gravity during dodges
+        physics.velocity.y += GameConfig::GRAVITY * 0.5f;
+        break;
+    }
 
-    // Variables for collision detection
-    const int collisionSteps = 4; // Number of sub-steps for collision checking
-    float stepX = physics.velocity.x / collisionSteps;
-    float stepY = physics.velocity.y / collisionSteps;
+    return true;
+}
+
+void Character::finishUpdate(const PlatformContact& contact)
+{
+    // Stop on whichever axis a platform blocked
+    physics.position = contact.position;
+    physics.ground = contact.ground;
+    if (contact.landed)
+    {
+        physics.velocity.y = 0;
+    }
+    if (contact.blockedX)
+    {
+        physics.velocity.x = 0;
+    }
+    bool onGround = contact.landed;
 
-    // Process current state
     switch (stateManager.state)
     {
     case IDLE:
@@ -181,93 +254,12 @@ void Character::update(std::vector<Platform>& platforms)
     case JUMPING:
     case FALLING:
         {
-            // Apply gravity
-            physics.applyGravity();
-
-            // Handle collisions with sub-frame precision
-            for (int step = 0; step < collisionSteps; step++)
+            if (onGround)
             {
-                // Apply partial movement
-                physics.updatePositionPartial(stepX, stepY);
-
-                // Platform collision on each sub-step
-                for (auto& platform : platforms)
-                {
-                    Rectangle playerRect = getRect();
-                    if (CheckCollisionRecs(playerRect, platform.rect))
-                    {
-                        // Handle collision based on platform type
-                        if (platform.type == SOLID)
-                        {
-                            // SOLID platforms have collision from all sides
-
-                            // Top collision - only check if moving downward
-                            if (stepY > 0)
-                            {
-                                if (playerRect.y + playerRect.height > platform.rect.y &&
-                                    playerRect.y + playerRect.height < platform.rect.y + platform.rect.height / 2)
-                                {
-                                    physics.position.y = platform.rect.y - height / 2;
-                                    physics.velocity.y = 0;
-                                    onGround = true;
-
-                                    // Reset states that need ground
-                                    if (stateManager.isJumping) stateManager.isJumping = false;
-                                    stateManager.hasDoubleJump = true;
-                                    stateManager.isHitstun = false;
-                                    break; // Found a top collision, stop checking other platforms
-                                }
-                            }
-
-                            // Side collisions - prevent movement into platforms
-                            // Only apply side collision if player's feet are below platform top
-                            // AND player's top is not above platform bottom (to allow movement under platforms)
-                            if (playerRect.y + playerRect.height > platform.rect.y + 5 &&
-                                playerRect.y < platform.rect.y + platform.rect.height)
-                            {
-                                // Right side collision - player moving right into platform left edge
-                                if (stepX > 0 &&
-                                    playerRect.x + playerRect.width > platform.rect.x &&
-                                    playerRect.x < platform.rect.x)
-                                {
-                                    physics.position.x = platform.rect.x - width / 2;
-                                    physics.velocity.x = 0;
-                                }
-                                // Left side collision - player moving left into platform right edge
-                                else if (stepX < 0 &&
-                                    playerRect.x < platform.rect.x + platform.rect.width &&
-                                    playerRect.x + playerRect.width > platform.rect.x + platform.rect.width)
-                                {
-                                    physics.position.x = platform.rect.x + platform.rect.width + width / 2;
-                                    physics.velocity.x = 0;
-                                }
-                            }
-                        }
-                        else if (platform.type == PASSTHROUGH)
-                        {
-                            // PASSTHROUGH platforms only have collision from above
-
-                            // Top collision - only check if moving downward
-                            if (stepY > 0)
-                            {
-                                // Previous position was above the platform
-                                if (playerRect.y + playerRect.height - stepY <= platform.rect.y)
-                                {
-                                    physics.position.y = platform.rect.y - height / 2;
-                                    physics.velocity.y = 0;
-                                    onGround = true;
-
-                                    // Reset states that need ground
-                                    if (stateManager.isJumping) stateManager.isJumping = false;
-                                    stateManager.hasDoubleJump = true;
-                                    stateManager.isHitstun = false;
-                                    break; // Found a top collision, stop checking other platforms
-                                }
-                            }
-                            // No side or bottom collisions for passthrough platforms
-                        }
-                    }
-                }
+                // Reset states that need ground
+                if (stateManager.isJumping) stateManager.isJumping = false;
+                stateManager.hasDoubleJump = true;
+                stateManager.isHitstun = false;
             }
 
             // Update state based on movement
@@ -314,100 +306,12 @@ void Character::update(std::vector<Platform>& platforms)
 
     case ATTACKING:
         {
-            // Apply gravity during attacks
-            physics.applyGravity();
-
-            // Limited horizontal movement during attacks
-            float modifiedVelocityX = physics.velocity.x * 0.5f;
-
-            // Setup sub-frame precision for collision detection
-            stepX = modifiedVelocityX / collisionSteps;
-            stepY = physics.velocity.y / collisionSteps;
-
-            for (int step = 0; step < collisionSteps; step++)
+            // Ground attacks continue
+            // Air attacks may cancel on landing
+            if (onGround && stateManager.currentAttack >= NEUTRAL_AIR && stateManager.currentAttack <= DOWN_AIR)
             {
-                // Apply partial movement
-                physics.updatePositionPartial(stepX, stepY);
-
-                // Platform collision handling - similar to above
-                for (auto& platform : platforms)
-                {
-                    Rectangle playerRect = getRect();
-                    if (CheckCollisionRecs(playerRect, platform.rect))
-                    {
-                        if (platform.type == SOLID)
-                        {
-                            // Full collision for solid platforms
-
-                            // Top collision
-                            if (stepY > 0)
-                            {
-                                if (playerRect.y + playerRect.height > platform.rect.y &&
-                                    playerRect.y + playerRect.height < platform.rect.y + platform.rect.height / 2)
-                                {
-                                    physics.position.y = platform.rect.y - height / 2;
-                                    physics.velocity.y = 0;
-                                    onGround = true;
-
-                                    // Ground attacks continue
-                                    // Air attacks may cancel on landing
-                                    if (stateManager.currentAttack >= NEUTRAL_AIR && stateManager.currentAttack <=
-                                        DOWN_AIR)
-                                    {
-                                        resetAttackState();
-                                        stateManager.changeState(IDLE);
-                                    }
-                                    break; // Found a top collision, stop checking other platforms
-                                }
-                            }
-
-                            // Side collisions
-                            if (playerRect.y + playerRect.height > platform.rect.y + 5 &&
-                                playerRect.y < platform.rect.y + platform.rect.height)
-                            {
-                                // Right side collision
-                                if (stepX > 0 &&
-                                    playerRect.x + playerRect.width > platform.rect.x &&
-                                    playerRect.x < platform.rect.x)
-                                {
-                                    physics.position.x = platform.rect.x - width / 2;
-                                    physics.velocity.x = 0;
-                                }
-                                // Left side collision
-                                else if (stepX < 0 &&
-                                    playerRect.x < platform.rect.x + platform.rect.width &&
-                                    playerRect.x + playerRect.width > platform.rect.x + platform.rect.width)
-                                {
-                                    physics.position.x = platform.rect.x + platform.rect.width + width / 2;
-                                    physics.velocity.x = 0;
-                                }
-                            }
-                        }
-                        else if (platform.type == PASSTHROUGH)
-                        {
-                            // Only top collision for passthrough platforms
-                            if (stepY > 0)
-                            {
-                                // Check if coming from above
-                                if (playerRect.y + playerRect.height - stepY <= platform.rect.y)
-                                {
-                                    physics.position.y = platform.rect.y - height / 2;
-                                    physics.velocity.y = 0;
-                                    onGround = true;
-
-                                    // Check if air attack should cancel on landing
-                                    if (stateManager.currentAttack >= NEUTRAL_AIR && stateManager.currentAttack <=
-                                        DOWN_AIR)
-                                    {
-                                        resetAttackState();
-                                        stateManager.changeState(IDLE);
-                                    }
-                                    break;
-                                }
-                            }
-                        }
-                    }
-                }
+                resetAttackState();
+                stateManager.changeState(IDLE);
             }
 
             // Update attack positions and increment attack frame
@@ -444,138 +348,8 @@ void Character::update(std::vector<Platform>& platforms)
         break;
 
     case SHIELDING:
-        // No movement while shielding
-        physics.velocity.x = 0;
-        physics.velocity.y = 0;
-        break;
-
     case DODGING:
-        {
-            // Apply reduced gravity during dodges
-            physics.velocity.y += GameConfig::GRAVITY * 0.5f;
-
-            // Same collision logic as above for movement
-            for (int step = 0; step < collisionSteps; step++)
-            {
-                physics.updatePositionPartial(stepX, stepY);
-
-                // Platform collision
-                for (auto& platform : platforms)
-                {
-                    Rectangle playerRect = getRect();
-                    if (CheckCollisionRecs(playerRect, platform.rect))
-                    {
-                        if (platform.type == SOLID)
-                        {
-                            // Top collision
-                            if (stepY > 0 && playerRect.y + playerRect.height > platform.rect.y &&
-                                playerRect.y + playerRect.height < platform.rect.y + platform.rect.height / 2)
-                            {
-                                physics.position.y = platform.rect.y - height / 2;
-                                physics.velocity.y = 0;
-                                onGround = true;
-                                break;
-                            }
-
-                            // Side collisions
-                            if (playerRect.y + playerRect.height > platform.rect.y + 5 &&
-                                playerRect.y < platform.rect.y + platform.rect.height)
-                            {
-                                // Right collision
-                                if (stepX > 0 && playerRect.x + playerRect.width > platform.rect.x &&
-                                    playerRect.x < platform.rect.x)
-                                {
-                                    physics.position.x = platform.rect.x - width / 2;
-                                    physics.velocity.x = 0;
-                                }
-                                // Left collision
-                                else if (stepX < 0 && playerRect.x < platform.rect.x + platform.rect.width &&
-                                    playerRect.x + playerRect.width > platform.rect.x + platform.rect.width)
-                                {
-                                    physics.position.x = platform.rect.x + platform.rect.width + width / 2;
-                                    physics.velocity.x = 0;
-                                }
-                            }
-                        }
-                        else if (platform.type == PASSTHROUGH && stepY > 0)
-                        {
-                            // Passthrough top collision
-                            if (playerRect.y + playerRect.height - stepY <= platform.rect.y)
-                            {
-                                physics.position.y = platform.rect.y - height / 2;
-                                physics.velocity.y = 0;
-                                onGround = true;
-                                break;
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        break;
-
     case HITSTUN:
-        {
-            // Apply gravity
-            physics.applyGravity();
-
-            // Same collision logic as above
-            for (int step = 0; step < collisionSteps; step++)
-            {
-                physics.updatePositionPartial(stepX, stepY);
-
-                for (auto& platform : platforms)
-                {
-                    Rectangle playerRect = getRect();
-                    if (CheckCollisionRecs(playerRect, platform.rect))
-                    {
-                        if (platform.type == SOLID)
-                        {
-                            // Top collision
-                            if (stepY > 0 && playerRect.y + playerRect.height > platform.rect.y &&
-                                playerRect.y + playerRect.height < platform.rect.y + platform.rect.height / 2)
-                            {
-                                physics.position.y = platform.rect.y - height / 2;
-                                physics.velocity.y = 0;
-                                onGround = true;
-                                break;
-                            }
-
-                            // Side collisions
-                            if (playerRect.y + playerRect.height > platform.rect.y + 5 &&
-                                playerRect.y < platform.rect.y + platform.rect.height)
-                            {
-                                // Right collision
-                                if (stepX > 0 && playerRect.x + playerRect.width > platform.rect.x &&
-                                    playerRect.x < platform.rect.x)
-                                {
-                                    physics.position.x = platform.rect.x - width / 2;
-                                    physics.velocity.x = 0;
-                                }
-                                // Left collision
-                                else if (stepX < 0 && playerRect.x < platform.rect.x + platform.rect.width &&
-                                    playerRect.x + playerRect.width > platform.rect.x + platform.rect.width)
-                                {
-                                    physics.position.x = platform.rect.x + platform.rect.width + width / 2;
-                                    physics.velocity.x = 0;
-                                }
-                            }
-                        }
-                        else if (platform.type == PASSTHROUGH && stepY > 0)
-                        {
-                            // Passthrough top collision
-                            if (playerRect.y + playerRect.height - stepY <= platform.rect.y)
-                            {
-                                physics.position.y = platform.rect.y - height / 2;
-                                physics.velocity.y = 0;
-                                onGround = true;
-                                break;
-                            }
-                        }
-                    }
-                }
-            }
-        }
         break;
     }
 
@@ -596,116 +370,6 @@ void Character::update(std::vector<Platform>& platforms)
     {
         resetAttackState();
     }
-
-    // Update hit effects
-    for (int i = 0; i < hitEffects.size(); i++)
-    {
-        if (!hitEffects[i].update())
-        {
-            hitEffects.erase(hitEffects.begin() + i);
-            i--;
-        }
-    }
-}
-
-void Character::draw()
-{
-    // Skip normal drawing if exploding
-    if (stateManager.isExploding)
-    {
-        drawExplosionAnimation();
-        return;
-    }
-
-    // Skip normal drawing if dying
-    if (stateManager.isDying)
-    {
-        drawDeathAnimation(); // Original death animation
-        return;
-    }
-
-    // Visual effects for states
-    Color drawColor = color;
-
-    // Flashing for invincibility
-    if (stateManager.isInvincible)
-    {
-        if ((framesCounter / 3) % 2 == 0)
-        {
-            drawColor.a = 128; // Half opacity
-        }
-    }
-
-    // Damage gradient
-    if (damagePercent > 0)
-    {
-        // Gradually shift to red as damage increases
-        float damageRatio = std::min(damagePercent / 150.0f, 1.0f);
-        drawColor.r = std::min(255, drawColor.r + static_cast<int>(damageRatio * 100));
-        drawColor.g = std::max(0, drawColor.g - static_cast<int>(damageRatio * 80));
-        drawColor.b = std::max(0, drawColor.b - static_cast<int>(damageRatio * 80));
-    }
-
-    // Basic character drawing
-    DrawRectangle(
-        static_cast<int>(physics.position.x - width / 2),
-        static_cast<int>(physics.position.y - height / 2),
-        static_cast<int>(width),
-        static_cast<int>(height),
-        drawColor
-    );
-
-    // Direction indicator (eyes/face)
-    float eyeOffset = stateManager.isFacingRight ? width * 0.2f : -width * 0.2f;
-    DrawCircle(
-        static_cast<int>(physics.position.x + eyeOffset),
-        static_cast<int>(physics.position.y - height * 0.1f),
-        width * 0.15f,
-        BLACK
-    );
-
-    // Shield visualization
-    if (stateManager.isShielding)
-    {
-        float shieldRatio = stateManager.shieldHealth / GameConfig::MAX_SHIELD_HEALTH;
-        float shieldSize = (width + height) * 0.4f * shieldRatio;
-        Color shieldColor = {100, 200, 255, 128}; // Semi-transparent blue
-
-        // Shield color shifts to red as it weakens
-        shieldColor.g = static_cast<unsigned char>(200 * shieldRatio);
-        shieldColor.b = static_cast<unsigned char>(255 * shieldRatio);
-
-        DrawCircleV(physics.position, shieldSize, shieldColor);
-    }
-
-    // Draw hitboxes if attacking and not dying/exploding (for debug)
-    if (stateManager.isAttacking && !stateManager.isDying && !stateManager.isExploding)
-    {
-        for (auto& attack : attacks)
-        {
-            attack.draw(true);
-        }
-    }
-
-    // Draw hit effects
-    for (auto& effect : hitEffects)
-    {
-        effect.draw();
-    }
-
-    // Draw percentage above character
-    char damageText[10];
-    sprintf(damageText, "%.0f%%", damagePercent);
-    DrawText(
-        damageText,
-        static_cast<int>(physics.position.x - width / 2),
-        static_cast<int>(physics.position.y - height - 20),
-        20,
-        WHITE
-    );
-
-    // Animation counter
-    framesCounter++;
 }
 
 // Movement method delegations
@@ -851,23 +515,19 @@ void Character::neutralSpecial()
         stateManager.specialNeutralCD.reset();
 
         // Create projectile hitbox
-        float hitboxWidth = width * 0.5f;
-        float hitboxHeight = width * 0.5f;
-        float hitboxX = stateManager.isFacingRight
-                            ? physics.position.x + width
-                            : physics.position.x - width - hitboxWidth;
-        float hitboxY = physics.position.y - hitboxHeight / 2;
-
-        Rectangle hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
-
-        // Create a projectile with velocity and set to destroy on hit
-        Vector2 projectileVelocity = {stateManager.isFacingRight ? 12.0f : -12.0f, 0.0f};
-
-        // Create the projectile with the PROJECTILE type explicitly
-        AttackBox projectile(hitboxRect, 8.0f, 3.0f, 0.1f, stateManager.isFacingRight ? 0.0f : 180.0f, 15, 60,
-                             projectileVelocity, true);
-        projectile.type = AttackBox::PROJECTILE;
-        attacks.push_back(projectile);
+        Real hitboxWidth = realHalf(width);
+        Real hitboxHeight = realHalf(width);
+        Real hitboxX = stateManager.isFacingRight
+                           ? physics.position.x + width
+                           : physics.position.x - width - hitboxWidth;
+        Real hitboxY = physics.position.y - realHalf(hitboxHeight);
+
+        Rect hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
+
+        // The world moves it from here on; it keeps flying after the attack ends
+        Vec2 projectileVelocity = {stateManager.isFacingRight ? PROJECTILE_SPEED : -PROJECTILE_SPEED, 0.0f};
+        ProjectileHit hit = {8.0f, 3.0f, 0.1f, stateManager.isFacingRight ? 0.0f : 180.0f, 15, 0};
+        currentProjectiles().spawn(slot, hitboxRect, projectileVelocity, PROJECTILE_LIFETIME, hit);
     }
 }
 
@@ -886,14 +546,14 @@ void Character::sideSpecial()
         physics.velocity.x = stateManager.isFacingRight ? speed * 2.0f : -speed * 2.0f;
 
         // Create side special hitbox
-        float hitboxWidth = width * 1.2f;
-        float hitboxHeight = height * 0.7f;
-        float hitboxX = stateManager.isFacingRight
-                            ? physics.position.x + width / 2
-                            : physics.position.x - width / 2 - hitboxWidth;
-        float hitboxY = physics.position.y - hitboxHeight / 2;
-
-        Rectangle hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
+        Real hitboxWidth = Real(width) * Real(1.2f);
+        Real hitboxHeight = Real(height) * Real(0.7f);
+        Real hitboxX = stateManager.isFacingRight
+                           ? physics.position.x + width / 2
+                           : physics.position.x - width / 2 - hitboxWidth;
+        Real hitboxY = physics.position.y - realHalf(hitboxHeight);
+
+        Rect hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
         attacks.push_back(AttackBox(hitboxRect, 12.0f, 6.0f, 0.2f, stateManager.isFacingRight ? 45.0f : 135.0f, 15,
                                     15));
     }
@@ -918,12 +578,12 @@ void Character::upSpecial()
         stateManager.hasDoubleJump = true;
 
         // Create up special hitbox that follows the character
-        float hitboxWidth = width * 1.1f;
-        float hitboxHeight = height * 1.1f;
-        float hitboxX = physics.position.x - hitboxWidth / 2;
-        float hitboxY = physics.position.y - hitboxHeight / 2;
+        Real hitboxWidth = Real(width) * Real(1.1f);
+        Real hitboxHeight = Real(height) * Real(1.1f);
+        Real hitboxX = physics.position.x - realHalf(hitboxWidth);
+        Real hitboxY = physics.position.y - realHalf(hitboxHeight);
 
-        Rectangle hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
+        Rect hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
         attacks.push_back(AttackBox(hitboxRect, 7.0f, 5.0f, 0.15f, 80.0f, 12, 12));
     }
 }
@@ -944,12 +604,12 @@ void Character::downSpecial()
         // For now just set up the state
 
         // Create visual indicator hitbox (no damage)
-        float hitboxWidth = width * 1.5f;
-        float hitboxHeight = height * 1.5f;
-        float hitboxX = physics.position.x - hitboxWidth / 2;
-        float hitboxY = physics.position.y - hitboxHeight / 2;
+        Real hitboxWidth = Real(width) * Real(1.5f);
+        Real hitboxHeight = Real(height) * Real(1.5f);
+        Real hitboxX = physics.position.x - realHalf(hitboxWidth);
+        Real hitboxY = physics.position.y - realHalf(hitboxHeight);
 
-        Rectangle hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
+        Rect hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
         // Counter hitboxes should be created dynamically when hit
     }
 }
@@ -966,14 +626,14 @@ void Character::grab()
         stateManager.changeState(ATTACKING);
 
         // Create grab hitbox
-        float hitboxWidth = width * 0.6f;
-        float hitboxHeight = height * 0.6f;
-        float hitboxX = stateManager.isFacingRight
-                            ? physics.position.x + width / 2
-                            : physics.position.x - width / 2 - hitboxWidth;
-        float hitboxY = physics.position.y - hitboxHeight / 2;
-
-        Rectangle hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
+        Real hitboxWidth = Real(width) * Real(0.6f);
+        Real hitboxHeight = Real(height) * Real(0.6f);
+        Real hitboxX = stateManager.isFacingRight
+                           ? physics.position.x + width / 2
+                           : physics.position.x - width / 2 - hitboxWidth;
+        Real hitboxY = physics.position.y - realHalf(hitboxHeight);
+
+        Rect hitboxRect = {hitboxX, hitboxY, hitboxWidth, hitboxHeight};
         AttackBox grabBox(hitboxRect, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0);
         grabBox.type = AttackBox::GRAB;
         attacks.push_back(grabBox);
@@ -1088,136 +748,122 @@ bool Character::checkHit(Character& other)
     // Check each attack hitbox
     for (auto it = attacks.begin(); it != attacks.end();)
     {
-        auto& attack = *it;
-
-        // Skip if attack is not active
-        if (!attack.isActive)
+        Rect otherHurtbox = other.getHurtbox();
+        if (!it->isActive || !rectsOverlap(it->rect, otherHurtbox))
         {
             ++it;
             continue;
         }
 
-        Rectangle otherHurtbox = other.getHurtbox();
-
-        if (CheckCollisionRecs(attack.rect, otherHurtbox))
+        hitOccurred = true;
+        if (applyHit(*it, other))
         {
-            hitOccurred = true;
+            createHitEffect(hitPoint(it->rect, otherHurtbox));
+        }
+        ++it;
+    }
 
-            // Handle different hitbox types
-            switch (attack.type)
-            {
-            case AttackBox::GRAB:
-                // Initiate grab
-                if (!other.stateManager.isShielding)
-                {
-                    stateManager.isGrabbing = true;
-                    grabbedCharacter = &other;
-                    stateManager.grabDuration = 120; // Hold for 2 seconds max
-                    stateManager.grabFrame = 0;
-
-                    // Position the grabbed character
-                    float grabOffset = stateManager.isFacingRight ? width : -width;
-                    other.physics.position.x = physics.position.x + grabOffset;
-                    other.physics.position.y = physics.position.y;
-
-                    other.physics.velocity = {0, 0};
-                    other.stateManager.isHitstun = true;
-                    other.stateManager.hitstunFrames = 1; // Keep in hitstun while grabbed
-                }
-                ++it; // Move to next attack
-                break;
+    return hitOccurred;
+}
 
-            case AttackBox::NORMAL:
-            default:
-                // Handle shield
-                if (other.stateManager.isShielding)
-                {
-                    // Reduce shield health
-                    other.stateManager.shieldHealth -= attack.damage * GameConfig::SHIELD_DAMAGE_MULTIPLIER;
+bool Character::applyHit(AttackBox& attack, Character& other)
+{
+    bool damaged = false;
 
-                    // Shield break
-                    if (other.stateManager.shieldHealth <= 0)
-                    {
-                        other.stateManager.shieldHealth = 0;
-                        other.stateManager.isShielding = false;
-                        other.stateManager.isHitstun = true;
-                        other.stateManager.hitstunFrames = GameConfig::SHIELD_BREAK_STUN;
+    // Handle different hitbox types
+    switch (attack.type)
+    {
+    case AttackBox::GRAB:
+        // Initiate grab
+        if (!other.stateManager.isShielding)
+        {
+            stateManager.isGrabbing = true;
+            grabbedCharacter = &other;
+            stateManager.grabDuration = 120; // Hold for 2 seconds max
+            stateManager.grabFrame = 0;
+
+            // Position the grabbed character
+            Real grabOffset = stateManager.isFacingRight ? width : -width;
+            other.physics.position.x = physics.position.x + grabOffset;
+            other.physics.position.y = physics.position.y;
+
+            other.physics.velocity = {0, 0};
+            other.stateManager.isHitstun = true;
+            other.stateManager.hitstunFrames = 1; // Keep in hitstun while grabbed
+        }
+        break;
 
-                        // Apply upward knockback
-                        other.physics.velocity.y = -8.0f;
-                    }
+    case AttackBox::NORMAL:
+    default:
+        // Handle shield
+        if (other.stateManager.isShielding)
+        {
+            // Reduce shield health
+            other.stateManager.shieldHealth -= attack.damage * Real(GameConfig::SHIELD_DAMAGE_MULTIPLIER);
 
-                    // Shield stun
-                    other.stateManager.isHitstun = true;
-                    other.stateManager.hitstunFrames = GameConfig::SHIELD_STUN_FRAMES + attack.shieldStun;
-                }
-                else
-                {
-                    // Apply damage and knockback
-                    other.applyDamage(attack.damage);
-
-                    // Calculate knockback direction
-                    float knockbackAngle = attack.knockbackAngle * DEG2RAD;
-                    float directionX = cosf(knockbackAngle);
-                    float directionY = sinf(knockbackAngle);
-
-                    // Apply knockback
-                    other.applyKnockback(
-                        attack.damage,
-                        attack.baseKnockback,
-                        attack.knockbackScaling,
-                        directionX,
-                        directionY
-                    );
-
-                    // Create hit effect
-                    Vector2 hitPos = {
-                        (attack.rect.x + attack.rect.width / 2 + otherHurtbox.x + otherHurtbox.width / 2) / 2,
-                        (attack.rect.y + attack.rect.height / 2 + otherHurtbox.y + otherHurtbox.height / 2) / 2
-                    };
-                    createHitEffect(hitPos);
-                }
+            // Shield break
+            if (other.stateManager.shieldHealth <= 0)
+            {
+                other.stateManager.shieldHealth = 0;
+                other.stateManager.isShielding = false;
+                other.stateManager.isHitstun = true;
+                other.stateManager.hitstunFrames = GameConfig::SHIELD_BREAK_STUN;
 
-            // Handle projectile destruction
-                if (attack.type == AttackBox::PROJECTILE && attack.destroyOnHit)
-                {
-                    attack.isActive = false;
-                    // Don't advance iterator since we'll be removing this element
-                    it = attacks.erase(it);
-                }
-                else
-                {
-                    // For non-projectiles or projectiles that don't destroy on hit
-                    ++it;
-                }
-                break;
+                // Apply upward knockback
+                other.physics.velocity.y = -8.0f;
             }
+
+            // Shield stun
+            other.stateManager.isHitstun = true;
+            other.stateManager.hitstunFrames = GameConfig::SHIELD_STUN_FRAMES + attack.shieldStun;
         }
         else
         {
-            // Move to next attack if no collision
-            ++it;
+            // Apply damage and knockback
+            other.applyDamage(attack.damage);
+
+            // Calculate knockback direction
+            Real directionX = degreeCos(attack.knockbackAngle);
+            Real directionY = degreeSin(attack.knockbackAngle);
+
+            // Apply knockback
+            other.applyKnockback(
+                attack.damage,
+                attack.baseKnockback,
+                attack.knockbackScaling,
+                directionX,
+                directionY
+            );
+
+            damaged = true;
         }
+
+        // Projectiles that are destroyed on hit are spent
+        if (attack.type == AttackBox::PROJECTILE && attack.destroyOnHit)
+        {
+            attack.isActive = false;
+        }
+        break;
     }
 
-    return hitOccurred;
+    return damaged;
 }
 
-void Character::applyDamage(float damage)
+void Character::applyDamage(Real damage)
 {
     damagePercent += damage;
-    if (damagePercent > GameConfig::MAX_DAMAGE)
+    if (damagePercent > Real(GameConfig::MAX_DAMAGE))
     {
         damagePercent = GameConfig::MAX_DAMAGE;
     }
 }
 
-void Character::applyKnockback(float damage, float baseKnockback, float knockbackScaling,
-                               float directionX, float directionY)
+void Character::applyKnockback(Real damage, Real baseKnockback, Real knockbackScaling,
+                               Real directionX, Real directionY)
 {
     // THIS IS CORRECT: Calculate knockback based on damage and scaling
-    float damageMultiplier = 1.0f + (damagePercent * GameConfig::DAMAGE_SCALING);
-    float knockbackMagnitude = baseKnockback + (knockbackScaling * damageMultiplier);
+    Real damageMultiplier = Real(1.0f) + (damagePercent * Real(GameConfig::DAMAGE_SCALING));
+    Real knockbackMagnitude = baseKnockback + (knockbackScaling * damageMultiplier);
 
     // Apply knockback velocity
     physics.velocity.x = directionX * knockbackMagnitude;
@@ -1228,7 +874,7 @@ void Character::applyKnockback(float damage, float baseKnockback, float knockbac
 
     // Set hitstun frames based on knockback
     stateManager.isHitstun = true;
-    stateManager.hitstunFrames = static_cast<int>(knockbackMagnitude * GameConfig::HITSTUN_MULTIPLIER);
+    stateManager.hitstunFrames = static_cast<int>(knockbackMagnitude * Real(GameConfig::HITSTUN_MULTIPLIER));
 
     // Change state to hitstun
     stateManager.changeState(HITSTUN);
@@ -1240,7 +886,8 @@ void Character::applyKnockback(float damage, float baseKnockback, float knockbac
 
 void Character::createHitEffect(Vector2 position)
 {
-    hitEffects.push_back(HitEffect(position, color));
+    // The world's effects own the flash from here on
+    currentVfx().addHitFlash(position, color);
 }
 
 // Death animation implementation
@@ -1300,51 +947,17 @@ void Character::updateDeathAnimation()
             // Respawn at center top
             physics.position.x = GameConfig::SCREEN_WIDTH / 2;
             physics.position.y = 100;
+            physics.resetInterpolation();
 
             stateManager.changeState(FALLING);
         }
     }
 }
 
-void Character::drawDeathAnimation()
-{
-    // Draw spinning, shrinking character
-    Rectangle destRect = {
-        deathPosition.x,
-        deathPosition.y,
-        width * deathScale,
-        height * deathScale
-    };
-
-    // Center the rectangle for rotation
-    destRect.x -= destRect.width / 2;
-    destRect.y -= destRect.height / 2;
-
-    // Draw rotated rectangle
-    DrawRectanglePro(
-        destRect,
-        {destRect.width / 2, destRect.height / 2},
-        deathRotation,
-        color
-    );
-
-    // Star burst effect near end of animation
-    if (stateManager.deathFrame > stateManager.deathDuration * 0.7f && stateManager.deathFrame % 3 == 0)
-    {
-        float starAngle = static_cast<float>(GetRandomValue(0, 360));
-        float starDist = static_cast<float>(GetRandomValue(10, 30));
-        Vector2 starPos = {
-            deathPosition.x + cosf(starAngle * DEG2RAD) * starDist,
-            deathPosition.y + sinf(starAngle * DEG2RAD) * starDist
-        };
-
-        DrawCircleV(starPos, 5.0f * deathScale, WHITE);
-    }
-}
-
 void Character::respawn(Vector2 spawnPoint)
 {
     physics.position = spawnPoint;
+    physics.resetInterpolation();
     physics.velocity = {0, 0};
     damagePercent = 0;
     stateManager.isInvincible = true;
@@ -1361,43 +974,16 @@ void Character::updateAttackPositions()
     {
         auto& attack = *it;
 
-        // For projectiles - update independent movement
-        if (attack.type == AttackBox::PROJECTILE)
-        {
-            bool isActive = attack.update();
-
-            // Check if projectile went off-screen
-            bool offScreen = attack.rect.x < GameConfig::BLAST_ZONE_LEFT ||
-                attack.rect.x > GameConfig::BLAST_ZONE_RIGHT ||
-                attack.rect.y < GameConfig::BLAST_ZONE_TOP ||
-                attack.rect.y > GameConfig::BLAST_ZONE_BOTTOM;
-
-            if (!isActive || offScreen)
-            {
-                // Remove expired or off-screen projectiles
-                it = attacks.erase(it);
-            }
-            else
-            {
-                ++it;
-            }
-            continue;
-        }
-
         // For normal attacks - update position relative to character
-        float offsetX = stateManager.isFacingRight ? 1.0f : -1.0f;
+        Real offsetX = stateManager.isFacingRight ? 1.0f : -1.0f;
 
-        // For non-projectile attacks, reposition them relative to the character
-        if (attack.type != AttackBox::PROJECTILE)
-        {
-            // Adjust based on attack box original position
-            float relativeX = attack.rect.width / 2.0f * offsetX;
-            float boxCenterX = physics.position.x + relativeX;
+        // Adjust based on attack box original position
+        Real relativeX = realHalf(attack.rect.width) * offsetX;
+        Real boxCenterX = physics.position.x + relativeX;
 
-            // Update position
-            attack.rect.x = boxCenterX - (attack.rect.width / 2.0f);
-            attack.rect.y = physics.position.y - (attack.rect.height / 2.0f);
-        }
+        // Update position
+        attack.rect.x = boxCenterX - realHalf(attack.rect.width);
+        attack.rect.y = physics.position.y - realHalf(attack.rect.height);
 
         // Update duration tracking for all attacks
         bool isActive = attack.update();
@@ -1418,7 +1004,7 @@ void Character::updateAttackPositions()
 void Character::checkForExplosion()
 {
     // Check if damage threshold reached for explosion
-    if (damagePercent >= EXPLOSION_DAMAGE_THRESHOLD && !stateManager.isDying && !stateManager.isExploding)
+    if (damagePercent >= Real(EXPLOSION_DAMAGE_THRESHOLD) && !stateManager.isDying && !stateManager.isExploding)
     {
         startExplosionAnimation();
     }
@@ -1429,43 +1015,14 @@ void Character::startExplosionAnimation()
     stateManager.isExploding = true;
     stateManager.explosionFrame = 0;
     stateManager.explosionDuration = 60; // 1 second explosion
-    explosionParticles.clear();
 
     // Clear all attacks when exploding
     resetAttackState();
 
-    // Create explosion particles
-    for (int i = 0; i < 150; i++)
-    {
-        float angle = GetRandomValue(0, 360) * DEG2RAD;
-        float speed = GetRandomValue(5, 15);
-        Vector2 particleVel = {
-            cosf(angle) * speed,
-            sinf(angle) * speed
-        };
-
-        float size = GetRandomValue(3, 12);
-        int lifespan = GetRandomValue(30, 90);
-
-        // Create varied colored particles
-        Color particleColor;
-        int colorChoice = GetRandomValue(0, 4);
-        switch (colorChoice)
-        {
-        case 0: particleColor = RED;
-            break;
-        case 1: particleColor = ORANGE;
-            break;
-        case 2: particleColor = YELLOW;
-            break;
-        case 3: particleColor = color;
-            break;
-        case 4: particleColor = WHITE;
-            break;
-        }
-
-        explosionParticles.push_back(Particle(physics.position, particleVel, size, lifespan, particleColor));
-    }
+    // Hand the particles and shockwave to the world's effects; the burst is baked
+    VfxManager& vfx = currentVfx();
+    BurstTemplates::explosion().spawn(vfx.particles, physics.position, color);
+    vfx.addShockwave(physics.position, stateManager.explosionDuration);
 
     // Reduce stock after explosion
     stocks--;
@@ -1481,49 +1038,10 @@ void Character::updateExplosionAnimation()
 {
     stateManager.explosionFrame++;
 
-    // Update existing explosion particles
-    for (int i = 0; i < explosionParticles.size(); i++)
-    {
-        if (!explosionParticles[i].update())
-        {
-            explosionParticles.erase(explosionParticles.begin() + i);
-            i--;
-        }
-    }
-
-    // Add new particles during the initial phase of explosion
+    // Add new particles during the initial phase of explosion; the pool moves and expires them
     if (stateManager.explosionFrame < stateManager.explosionDuration / 2)
     {
-        int particlesToAdd = 5;
-        for (int i = 0; i < particlesToAdd; i++)
-        {
-            float angle = GetRandomValue(0, 360) * DEG2RAD;
-            float speed = GetRandomValue(3, 10);
-            Vector2 particleVel = {
-                cosf(angle) * speed,
-                sinf(angle) * speed
-            };
-
-            float size = GetRandomValue(2, 8);
-            int lifespan = GetRandomValue(20, 60);
-
-            // Create more colorful particles for secondary explosion
-            Color particleColor;
-            int colorChoice = GetRandomValue(0, 3);
-            switch (colorChoice)
-            {
-            case 0: particleColor = RED;
-                break;
-            case 1: particleColor = ORANGE;
-                break;
-            case 2: particleColor = YELLOW;
-                break;
-            case 3: particleColor = WHITE;
-                break;
-            }
-
-            explosionParticles.push_back(Particle(physics.position, particleVel, size, lifespan, particleColor));
-        }
+        ParticleEmitter::emit(currentVfx().particles, Emitters::EXPLOSION_TRAIL, physics.position);
     }
 
     // End explosion animation
@@ -1543,32 +1061,9 @@ void Character::updateExplosionAnimation()
             // Respawn at center top
             physics.position.x = GameConfig::SCREEN_WIDTH / 2;
             physics.position.y = 100;
+            physics.resetInterpolation();
 
             stateManager.changeState(FALLING);
         }
     }
 }
-
-void Character::drawExplosionAnimation()
-{
-    // Draw explosion particles
-    for (auto& particle : explosionParticles)
-    {
-        particle.draw();
-    }
-
-    // Draw shockwave effect
-    float shockwaveRadius = stateManager.explosionFrame * 8.0f;
-    float alpha = 255 * (1.0f - (float)stateManager.explosionFrame / stateManager.explosionDuration);
-    Color shockwaveColor = {255, 200, 50, (unsigned char)alpha};
-
-    DrawCircleLines(physics.position.x, physics.position.y, shockwaveRadius, shockwaveColor);
-    DrawCircleLines(physics.position.x, physics.position.y, shockwaveRadius * 0.7f, shockwaveColor);
-
-    // Draw flash effect in early frames
-    if (stateManager.explosionFrame < 10)
-    {
-        Color flashColor = {255, 255, 255, (unsigned char)(255 * (1.0f - stateManager.explosionFrame / 10.0f))};
-        DrawRectangle(0, 0, GameConfig::SCREEN_WIDTH, GameConfig::SCREEN_HEIGHT, flashColor);
-    }
-}
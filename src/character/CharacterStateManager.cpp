@@ -118,7 +118,7 @@ void CharacterStateManager::updateTimers()
     // Update shield health
     if (isShielding) {
         shieldHealth = std::min(shieldHealth + GameConfig::SHIELD_REGEN_RATE, 
-                               GameConfig::MAX_SHIELD_HEALTH);
+                               Real(GameConfig::MAX_SHIELD_HEALTH));
     }
     
     // Update grab duration
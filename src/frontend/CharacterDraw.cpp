@@ -0,0 +1,192 @@
+#include "../../include/character/Character.h"
+#include "../../include/attacks/AttackBox.h"
+#include "../../include/ProjectilePool.h"
+#include "../../include/GameConfig.h"
+#include "../../include/Random.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+// Rendering for characters and their attached effects.
+// Lives in the frontend library so the simulation core never touches the window.
+
+void Character::draw(float alpha)
+{
+    // Skip normal drawing if exploding
+    if (stateManager.isExploding)
+    {
+        drawExplosionAnimation();
+        return;
+    }
+
+    // Skip normal drawing if dying
+    if (stateManager.isDying)
+    {
+        drawDeathAnimation(); // Original death animation
+        return;
+    }
+
+    // Blend between the last two simulation ticks
+    Vector2 drawPosition = physics.interpolatedPosition(alpha);
+
+    // Visual effects for states
+    Color drawColor = color;
+
+    // Flashing for invincibility
+    if (stateManager.isInvincible)
+    {
+        if ((framesCounter / 3) % 2 == 0)
+        {
+            drawColor.a = 128; // Half opacity
+        }
+    }
+
+    // Damage gradient
+    if (damagePercent > 0)
+    {
+        // Gradually shift to red as damage increases
+        float damageRatio = std::min(damagePercent / 150.0f, 1.0f);
+        drawColor.r = std::min(255, drawColor.r + static_cast<int>(damageRatio * 100));
+        drawColor.g = std::max(0, drawColor.g - static_cast<int>(damageRatio * 80));
+        drawColor.b = std::max(0, drawColor.b - static_cast<int>(damageRatio * 80));
+    }
+
+    // Basic character drawing
+    DrawRectangle(
+        static_cast<int>(drawPosition.x - width / 2),
+        static_cast<int>(drawPosition.y - height / 2),
+        static_cast<int>(width),
+        static_cast<int>(height),
+        drawColor
+    );
+
+    // Direction indicator (eyes/face)
+    float eyeOffset = stateManager.isFacingRight ? width * 0.2f : -width * 0.2f;
+    DrawCircle(
+        static_cast<int>(drawPosition.x + eyeOffset),
+        static_cast<int>(drawPosition.y - height * 0.1f),
+        width * 0.15f,
+        BLACK
+    );
+
+    // Shield visualization
+    if (stateManager.isShielding)
+    {
+        float shieldRatio = stateManager.shieldHealth / GameConfig::MAX_SHIELD_HEALTH;
+        float shieldSize = (width + height) * 0.4f * shieldRatio;
+        Color shieldColor = {100, 200, 255, 128}; // Semi-transparent blue
+
+        // Shield color shifts to red as it weakens
+        shieldColor.g = static_cast<unsigned char>(200 * shieldRatio);
+        shieldColor.b = static_cast<unsigned char>(255 * shieldRatio);
+
+        DrawCircleV(drawPosition, shieldSize, shieldColor);
+    }
+
+    // Draw hitboxes if attacking and not dying/exploding (for debug)
+    if (stateManager.isAttacking && !stateManager.isDying && !stateManager.isExploding)
+    {
+        for (auto& attack : attacks)
+        {
+            attack.draw(true);
+        }
+    }
+
+    // Hit effects are drawn in the batched particle pass
+
+    // Draw percentage above character
+    char damageText[10];
+    sprintf(damageText, "%.0f%%", getDamagePercent());
+    DrawText(
+        damageText,
+        static_cast<int>(drawPosition.x - width / 2),
+        static_cast<int>(drawPosition.y - height - 20),
+        20,
+        WHITE
+    );
+
+    // Animation counter
+    framesCounter++;
+}
+
+void Character::drawDeathAnimation()
+{
+    // Draw spinning, shrinking character
+    Rectangle destRect = {
+        deathPosition.x,
+        deathPosition.y,
+        width * deathScale,
+        height * deathScale
+    };
+
+    // Center the rectangle for rotation
+    destRect.x -= destRect.width / 2;
+    destRect.y -= destRect.height / 2;
+
+    // Draw rotated rectangle
+    DrawRectanglePro(
+        destRect,
+        {destRect.width / 2, destRect.height / 2},
+        deathRotation,
+        color
+    );
+
+    // Star burst effect near end of animation
+    if (stateManager.deathFrame > stateManager.deathDuration * 0.7f && stateManager.deathFrame % 3 == 0)
+    {
+        float starAngle = static_cast<float>(cosmeticRandom(0, 360));
+        float starDist = static_cast<float>(cosmeticRandom(10, 30));
+        Vector2 starPos = {
+            deathPosition.x + cosf(starAngle * DEG2RAD) * starDist,
+            deathPosition.y + sinf(starAngle * DEG2RAD) * starDist
+        };
+
+        DrawCircleV(starPos, 5.0f * deathScale, WHITE);
+    }
+}
+
+void Character::drawExplosionAnimation()
+{
+    // Explosion particles and the shockwave are drawn with the rest of the world's effects
+
+    // Draw flash effect in early frames
+    if (stateManager.explosionFrame < 10)
+    {
+        Color flashColor = {255, 255, 255, (unsigned char)(255 * (1.0f - stateManager.explosionFrame / 10.0f))};
+        DrawRectangle(0, 0, GameConfig::SCREEN_WIDTH, GameConfig::SCREEN_HEIGHT, flashColor);
+    }
+}
+
+void AttackBox::draw(bool debug)
+{
+    if (debug && isActive) {
+        // Draw hitbox visualization in debug mode
+        Color hitboxColor = {255, 0, 0, 128};
+        
+        // Different colors for different hitbox types
+        if (type == GRAB) {
+            hitboxColor = {0, 0, 255, 128}; // Blue for grabs
+        } else if (type == PROJECTILE) {
+            hitboxColor = {255, 255, 0, 128}; // Yellow for projectiles
+        }
+        
+        DrawRectangleRec(rect, hitboxColor);
+        DrawRectangleLinesEx(rect, 1.0f, RED);
+    }
+}
+
+void ProjectilePool::draw(float alpha) const
+{
+    // Same look as a projectile hitbox, pulled back along its velocity to the blended tick
+    Color projectileColor = {255, 255, 0, 128};
+    float back = 1.0f - alpha;
+    for (int i = 0; i < count; i++)
+    {
+        Rectangle drawRect = {
+            static_cast<float>(posX[i]) - velX[i] * back, static_cast<float>(posY[i]) - velY[i] * back,
+            width[i], height[i]
+        };
+        DrawRectangleRec(drawRect, projectileColor);
+        DrawRectangleLinesEx(drawRect, 1.0f, RED);
+    }
+}
@@ -0,0 +1,218 @@
+#include "ParticleRenderer.h"
+#include "VfxManager.h"
+#include "rlgl.h"
+#include <algorithm>
+#include <cmath>
+
+// Batched rendering for a world's effects
+
+namespace {
+    // Texture layout: soft disc in the left cell, ring in the right one
+    const int CELL_SIZE = 64;
+    const int BLEND_MODES[] = {BLEND_ALPHA, BLEND_ADDITIVE};
+
+    // Ring outline relative to the cell radius, roughly a 1 px line at hit-effect sizes
+    const float RING_RADIUS = 0.9f;
+    const float RING_HALF_WIDTH = 0.06f;
+
+    // Shockwave circles, as DrawCircleLines tessellates them
+    const int CIRCLE_SEGMENTS = 36;
+
+    struct UnitCircle {
+        Vector2 points[CIRCLE_SEGMENTS + 1];
+
+        UnitCircle() {
+            for (int i = 0; i <= CIRCLE_SEGMENTS; i++) {
+                float angle = i * (2.0f * PI / CIRCLE_SEGMENTS);
+                points[i] = {std::cos(angle), std::sin(angle)};
+            }
+        }
+    };
+
+    const UnitCircle& unitCircle() {
+        static const UnitCircle circle;
+        return circle;
+    }
+
+    unsigned char coverage(float value) {
+        return static_cast<unsigned char>(255.0f * std::min(std::max(value, 0.0f), 1.0f));
+    }
+}
+
+ParticleRenderer::ParticleRenderer()
+    : texture(), stats() {
+}
+
+void ParticleRenderer::load() {
+    // White texels with the shape in alpha, so vertex colors tint them directly
+    std::vector<Color> pixels(CELL_SIZE * 2 * CELL_SIZE);
+    for (int y = 0; y < CELL_SIZE; y++) {
+        for (int x = 0; x < CELL_SIZE; x++) {
+            float dx = (x + 0.5f) / CELL_SIZE * 2.0f - 1.0f;
+            float dy = (y + 0.5f) / CELL_SIZE * 2.0f - 1.0f;
+            float distance = std::sqrt(dx * dx + dy * dy);
+
+            // Solid core with a soft rim, close to DrawCircleV at small sizes
+            float disc = (1.0f - distance) * 6.0f;
+            float ring = 1.0f - std::fabs(distance - RING_RADIUS) / RING_HALF_WIDTH;
+
+            pixels[y * CELL_SIZE * 2 + x] = {255, 255, 255, coverage(disc)};
+            pixels[y * CELL_SIZE * 2 + CELL_SIZE + x] = {255, 255, 255, coverage(ring)};
+        }
+    }
+
+    Image image = {pixels.data(), CELL_SIZE * 2, CELL_SIZE, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+    texture = LoadTextureFromImage(image);
+    SetTextureFilter(texture, TEXTURE_FILTER_BILINEAR);
+}
+
+void ParticleRenderer::unload() {
+    if (texture.id != 0) {
+        UnloadTexture(texture);
+        texture = Texture2D();
+    }
+}
+
+void ParticleRenderer::add(const VfxManager& vfx) {
+    queued.push_back(&vfx);
+}
+
+void ParticleRenderer::flush() {
+    stats.drawCalls = 0;
+    stats.quads = 0;
+
+    for (int blend : BLEND_MODES) {
+        int quadsBefore = stats.quads;
+
+        // Switching blend mode flushes the rlgl batch, so each mode is drawn in one go
+        BeginBlendMode(blend);
+
+        for (const VfxManager* vfx : queued) {
+            drawParticles(*vfx, blend);
+
+            // Flashes and shockwaves are alpha blended
+            if (blend == BLEND_ALPHA) {
+                drawFlashes(*vfx);
+            }
+        }
+        rlSetTexture(0);
+
+        if (stats.quads > quadsBefore) {
+            stats.drawCalls++;
+        }
+
+        if (blend == BLEND_ALPHA) {
+            // Lines are a different primitive, so they take one more draw call
+            bool anyShockwaves = false;
+            for (const VfxManager* vfx : queued) {
+                drawShockwaves(*vfx);
+                anyShockwaves = anyShockwaves || vfx->shockwaveCount() > 0;
+            }
+            if (anyShockwaves) {
+                stats.drawCalls++;
+            }
+        }
+
+        EndBlendMode();
+    }
+
+    queued.clear();
+}
+
+void ParticleRenderer::drawParticles(const VfxManager& vfx, int blend) {
+    const ParticlePool& pool = vfx.particles;
+    const float* x = pool.positionX();
+    const float* y = pool.positionY();
+    const float* size = pool.sizes();
+    const int* life = pool.lives();
+    const int* lifespan = pool.lifespans();
+    const Color* colors = pool.colors();
+    const uint8_t* blends = pool.blendModes();
+
+    for (int i = 0; i < pool.size(); i++) {
+        if (blends[i] != blend) {
+            continue;
+        }
+
+        // Same fade as Particle::draw
+        Color color = colors[i];
+        color.a = static_cast<unsigned char>(255 * (1.0f - static_cast<float>(life[i]) / lifespan[i]));
+        drawQuad({x[i], y[i]}, size[i], color, DISC);
+    }
+}
+
+void ParticleRenderer::drawFlashes(const VfxManager& vfx) {
+    const float* x = vfx.flashX();
+    const float* y = vfx.flashY();
+    const Color* colors = vfx.flashColors();
+    const int* frames = vfx.flashFrames();
+
+    for (int i = 0; i < vfx.flashCount(); i++) {
+        // A disc with a ring around it, shrinking and fading out together
+        float scale = 1.0f - static_cast<float>(frames[i]) / VfxManager::FLASH_DURATION;
+        Color color = colors[i];
+        color.a = static_cast<unsigned char>(255.0f * scale);
+
+        float radius = VfxManager::FLASH_SIZE * scale;
+        drawQuad({x[i], y[i]}, radius, color, DISC);
+        drawQuad({x[i], y[i]}, radius * 1.2f, color, RING);
+    }
+}
+
+void ParticleRenderer::drawShockwaves(const VfxManager& vfx) {
+    const float* x = vfx.shockwaveX();
+    const float* y = vfx.shockwaveY();
+    const int* frames = vfx.shockwaveFrames();
+    const int* durations = vfx.shockwaveDurations();
+
+    for (int i = 0; i < vfx.shockwaveCount(); i++) {
+        float radius = frames[i] * VfxManager::SHOCKWAVE_SPEED;
+        Color color = {255, 200, 50, static_cast<unsigned char>(255 * (1.0f - static_cast<float>(frames[i]) / durations[i]))};
+
+        drawCircleLines({x[i], y[i]}, radius, color);
+        drawCircleLines({x[i], y[i]}, radius * 0.7f, color);
+    }
+}
+
+void ParticleRenderer::drawQuad(Vector2 center, float radius, Color color, Shape shape) {
+    // A full batch is drawn and restarted; that costs an extra draw call
+    if (rlCheckRenderBatchLimit(4)) {
+        stats.drawCalls++;
+    }
+
+    float u0 = shape == DISC ? 0.0f : 0.5f;
+    float u1 = u0 + 0.5f;
+
+    rlSetTexture(texture.id);
+    rlBegin(RL_QUADS);
+    rlColor4ub(color.r, color.g, color.b, color.a);
+    rlNormal3f(0.0f, 0.0f, 1.0f);
+
+    // Counter-clockwise, like DrawTexturePro
+    rlTexCoord2f(u0, 0.0f);
+    rlVertex2f(center.x - radius, center.y - radius);
+    rlTexCoord2f(u0, 1.0f);
+    rlVertex2f(center.x - radius, center.y + radius);
+    rlTexCoord2f(u1, 1.0f);
+    rlVertex2f(center.x + radius, center.y + radius);
+    rlTexCoord2f(u1, 0.0f);
+    rlVertex2f(center.x + radius, center.y - radius);
+    rlEnd();
+
+    stats.quads++;
+}
+
+void ParticleRenderer::drawCircleLines(Vector2 center, float radius, Color color) {
+    if (rlCheckRenderBatchLimit(2 * CIRCLE_SEGMENTS)) {
+        stats.drawCalls++;
+    }
+
+    const Vector2* points = unitCircle().points;
+    rlBegin(RL_LINES);
+    rlColor4ub(color.r, color.g, color.b, color.a);
+    for (int i = 0; i < CIRCLE_SEGMENTS; i++) {
+        rlVertex2f(center.x + points[i].x * radius, center.y + points[i].y * radius);
+        rlVertex2f(center.x + points[i + 1].x * radius, center.y + points[i + 1].y * radius);
+    }
+    rlEnd();
+}
@@ -0,0 +1,69 @@
+#include "Profiler.h"
+#include "raylib.h"
+#include <algorithm>
+
+// Rendering for the profiler overlay
+
+namespace {
+    const int PANEL_WIDTH = 330;
+    const int ROW_HEIGHT = 14;
+    const int FONT_SIZE = 10;
+    const int GRAPH_HEIGHT = 60;
+    const float FRAME_BUDGET_MS = 1000.0f / 60.0f;
+
+    // Children are listed under their parent, in the order they were first seen
+    int drawZoneRows(const std::vector<Profiler::Zone>& zones, int parent, int x, int y) {
+        for (size_t i = 0; i < zones.size(); i++) {
+            const Profiler::Zone& zone = zones[i];
+            if (zone.parent != parent) {
+                continue;
+            }
+
+            int indent = zone.depth * 10;
+            DrawText(zone.name, x + indent, y, FONT_SIZE, WHITE);
+            DrawText(TextFormat("%6.2f", zone.averageMs), x + 200, y, FONT_SIZE, WHITE);
+            DrawText(TextFormat("%6.2f", zone.maxMs), x + 245, y, FONT_SIZE, LIGHTGRAY);
+
+            // Share of the 60 Hz frame budget
+            float share = std::min(zone.averageMs / FRAME_BUDGET_MS, 1.0f);
+            DrawRectangle(x + 290, y + 2, static_cast<int>(30 * share), ROW_HEIGHT - 5, zone.depth == 0 ? ORANGE : YELLOW);
+
+            y = drawZoneRows(zones, static_cast<int>(i), x, y + ROW_HEIGHT);
+        }
+        return y;
+    }
+}
+
+void Profiler::drawOverlay(int x, int y) const {
+    int rows = static_cast<int>(zones.size()) + 3;
+    int height = rows * ROW_HEIGHT + GRAPH_HEIGHT + 20;
+    DrawRectangle(x - 5, y - 5, PANEL_WIDTH + 10, height, {0, 0, 0, 170});
+
+#if !VIBESTER_PROFILE
+    DrawText("Profiler compiled out (VIBESTER_PROFILE=0)", x, y, FONT_SIZE, LIGHTGRAY);
+    y += ROW_HEIGHT;
+#endif
+
+    // Header
+    DrawText(TextFormat("Frame %.2f ms avg, %.2f ms max", getAverageFrameMs(), getMaxFrameMs()), x, y, FONT_SIZE, WHITE);
+    y += ROW_HEIGHT;
+    DrawText("phase", x, y, FONT_SIZE, GRAY);
+    DrawText("avg ms", x + 200, y, FONT_SIZE, GRAY);
+    DrawText("max", x + 245, y, FONT_SIZE, GRAY);
+    y += ROW_HEIGHT;
+
+    y = drawZoneRows(zones, -1, x, y) + 6;
+
+    // Frame-time graph, oldest frame on the left; the line marks the 60 Hz budget
+    float scale = GRAPH_HEIGHT / (FRAME_BUDGET_MS * 2.0f);
+    int barWidth = std::max(1, PANEL_WIDTH / PROFILE_HISTORY_FRAMES);
+    for (int i = 0; i < PROFILE_HISTORY_FRAMES; i++) {
+        float ms = getFrameMs(PROFILE_HISTORY_FRAMES - 1 - i);
+        int barHeight = std::min(GRAPH_HEIGHT, static_cast<int>(ms * scale));
+        Color barColor = ms > FRAME_BUDGET_MS ? RED : GREEN;
+        DrawRectangle(x + i * barWidth, y + GRAPH_HEIGHT - barHeight, barWidth, barHeight, barColor);
+    }
+
+    int budgetY = y + GRAPH_HEIGHT - static_cast<int>(FRAME_BUDGET_MS * scale);
+    DrawLine(x, budgetY, x + PROFILE_HISTORY_FRAMES * barWidth, budgetY, WHITE);
+}
@@ -0,0 +1,49 @@
+#include "Platform.h"
+#include "Particle.h"
+#include "ParticleSystem.h"
+#include <algorithm>
+
+// Rendering for stage geometry and particles
+
+void Platform::draw() {
+    DrawRectangleRec(rect, color);
+
+    // Draw platform edge highlight
+    Color highlightColor = {
+        (unsigned char)std::min(color.r + 40, 255),
+        (unsigned char)std::min(color.g + 40, 255),
+        (unsigned char)std::min(color.b + 40, 255),
+        color.a
+    };
+
+    // Different visual styles for different platform types
+    if (type == PASSTHROUGH) {
+        // For pass-through platforms, only highlight the top edge
+        DrawLine(
+            rect.x, rect.y,
+            rect.x + rect.width, rect.y,
+            highlightColor
+        );
+    } else {
+        // For solid platforms, highlight all edges
+        DrawRectangleLines(rect.x, rect.y, rect.width, rect.height, highlightColor);
+    }
+}
+
+void Particle::draw() {
+    // Calculate alpha based on remaining life
+    unsigned char alpha = (unsigned char)(255 * (1.0f - (float)currentLife / lifespan));
+    Color drawColor = {color.r, color.g, color.b, alpha};
+
+    // Draw particle as circle
+    DrawCircleV(position, size, drawColor);
+}
+
+// Function to draw particles
+void drawParticles(const std::vector<Particle>& particles) {
+    for (int i = 0; i < particles.size(); i++) {
+        // Create a non-const copy to work around the const issue
+        Particle p = particles[i];
+        p.draw();
+    }
+}
@@ -2,8 +2,10 @@
 #include "Constants.h"
 #include "Character.h"
 #include "Platform.h"
+#include "PlatformGrid.h"
 #include "Particle.h"
 #include "ParticleSystem.h"
+#include "Random.h"
 #include <vector>
 #include <algorithm>
 #include <string>
@@ -24,6 +26,8 @@ int legacy_main() {  // Renamed to avoid duplicate main function
         Platform(SCREEN_WIDTH - 300, SCREEN_HEIGHT - 200, 200, 20, DARKGREEN),
         Platform(SCREEN_WIDTH / 2 - 100, SCREEN_HEIGHT - 300, 200, 20, DARKGREEN)
     };
+    PlatformGrid platformGrid;
+    platformGrid.build(platforms);
     
     // Particle system
     std::vector<Particle> particles;
@@ -57,17 +61,17 @@ int legacy_main() {  // Renamed to avoid duplicate main function
         if (enemy.physics.position.x < player.physics.position.x - 10) enemy.moveRight();
         else if (enemy.physics.position.x > player.physics.position.x + 10) enemy.moveLeft();
         
-        if (GetRandomValue(0, 100) < 2) enemy.jump();
+        if (gameplayRandom(0, 100) < 2) enemy.jump();
         
         // Enemy AI attack selection
-        int attackChoice = GetRandomValue(0, 100);
+        int attackChoice = gameplayRandom(0, 100);
         if (attackChoice < 3) enemy.neutralAttack();
         else if (attackChoice < 5) enemy.sideAttack();
         else if (attackChoice < 7) enemy.upAttack();
         else if (attackChoice < 9) enemy.downAttack();
         
         // Special attacks are less frequent
-        int specialChoice = GetRandomValue(0, 300);
+        int specialChoice = gameplayRandom(0, 300);
         if (specialChoice < 1) enemy.specialNeutralAttack();
         else if (specialChoice < 2) enemy.specialSideAttack();
         else if (specialChoice < 3) enemy.specialUpAttack();
@@ -78,8 +82,8 @@ int legacy_main() {  // Renamed to avoid duplicate main function
         bool enemyStartingDeath = !enemy.stateManager.isDying && enemy.physics.position.y > SCREEN_HEIGHT + 90;
         
         // Update characters
-        player.update(platforms);
-        enemy.update(platforms);
+        player.update(platforms, platformGrid);
+        enemy.update(platforms, platformGrid);
         
         // Check for newly started death animations
         if (!playerDiedLastFrame && player.stateManager.isDying) {
@@ -0,0 +1,224 @@
+#include "../../include/net/RollbackSession.h"
+#include "../../include/World.h"
+#include "../../include/Snapshot.h"
+#include "../../include/Cosmetics.h"
+#include "../../include/Profiler.h"
+#include <algorithm>
+#include <cassert>
+
+namespace
+{
+    const char PACKET_MAGIC[4] = {'V', 'B', 'N', 'P'};
+    const uint8_t PACKET_VERSION = 1 | REAL_FORMAT_FLAG;
+    const size_t PACKET_HEADER_SIZE = sizeof(PACKET_MAGIC) + 1 + 4 + 4 + 1;
+    const size_t MAX_INPUTS_PER_PACKET = 255;
+
+    void writeI32(std::vector<uint8_t>& out, int32_t value)
+    {
+        uint32_t bits = static_cast<uint32_t>(value);
+        for (int i = 0; i < 4; i++)
+        {
+            out.push_back(static_cast<uint8_t>(bits >> (i * 8)));
+        }
+    }
+
+    int32_t readI32(const uint8_t* bytes)
+    {
+        uint32_t bits = 0;
+        for (int i = 0; i < 4; i++)
+        {
+            bits |= static_cast<uint32_t>(bytes[i]) << (i * 8);
+        }
+        return static_cast<int32_t>(bits);
+    }
+}
+
+RollbackSession::RollbackSession(World& simulation, UdpTransport& link, int local, int maxRollback)
+    : world(simulation), transport(link), localPlayer(local), remotePlayer(1 - local),
+      maxRollbackFrames(std::max(1, maxRollback)), frame(0), history(maxRollbackFrames + 1),
+      unackedLocalFrame(0), confirmedRemoteFrame(-1), remoteInputsFrame(0),
+      firstMispredictedFrame(-1), lastRollbackFrames(0), totalRollbackFrames(0)
+{
+}
+
+bool RollbackSession::advance(const PlayerInput& localInput)
+{
+    receivePackets();
+
+    // Too far ahead of the peer to roll back safely; wait for its inputs
+    if (frame - confirmedRemoteFrame > maxRollbackFrames)
+    {
+        sendInputs();
+        return false;
+    }
+
+    if (firstMispredictedFrame >= 0)
+    {
+        rollback();
+    }
+
+    unackedLocalInputs.push_back(localInput);
+    runFrame(frame, localInput);
+    frame++;
+
+    // Older remote inputs can no longer be rolled back to
+    while (remoteInputsFrame < frame - maxRollbackFrames - 1 && !remoteInputs.empty())
+    {
+        remoteInputs.pop_front();
+        remoteInputsFrame++;
+    }
+
+    sendInputs();
+    return true;
+}
+
+void RollbackSession::poll()
+{
+    receivePackets();
+    if (firstMispredictedFrame >= 0)
+    {
+        rollback();
+    }
+    sendInputs();
+}
+
+RollbackSession::FrameRecord& RollbackSession::recordFor(int frameNumber)
+{
+    return history[frameNumber % history.size()];
+}
+
+PlayerInput RollbackSession::remoteInputFor(int frameNumber) const
+{
+    // Confirmed input if it has arrived, otherwise predict the last one repeats
+    if (frameNumber <= confirmedRemoteFrame && frameNumber >= remoteInputsFrame)
+    {
+        return remoteInputs[frameNumber - remoteInputsFrame];
+    }
+    return lastRemoteInput;
+}
+
+void RollbackSession::runFrame(int frameNumber, const PlayerInput& localInput)
+{
+    FrameRecord& record = recordFor(frameNumber);
+    Snapshot::save(world, record.snapshot, Snapshot::SIMULATION_ONLY);
+    record.inputs[localPlayer] = localInput;
+    record.inputs[remotePlayer] = remoteInputFor(frameNumber);
+
+    world.step(std::vector<PlayerInput>(record.inputs, record.inputs + 2));
+}
+
+void RollbackSession::rollback()
+{
+    PROFILE_SCOPE("rollback");
+
+    int target = firstMispredictedFrame;
+    firstMispredictedFrame = -1;
+
+    // Every record was saved from this world, so it always fits
+    bool restored = Snapshot::restore(world, recordFor(target).snapshot);
+    assert(restored);
+    (void)restored;
+
+    // These frames have already been shown, so skip their effects. The
+    // snapshot holds no effects, so the ones on screen carry on untouched.
+    CosmeticsScope quiet(false);
+    for (int f = target; f < frame; f++)
+    {
+        runFrame(f, recordFor(f).inputs[localPlayer]);
+    }
+
+    lastRollbackFrames = frame - target;
+    totalRollbackFrames += lastRollbackFrames;
+}
+
+void RollbackSession::receivePackets()
+{
+    transport.update();
+    while (transport.receive(packet))
+    {
+        handlePacket(packet);
+    }
+}
+
+void RollbackSession::handlePacket(const std::vector<uint8_t>& bytes)
+{
+    if (bytes.size() < PACKET_HEADER_SIZE ||
+        !std::equal(PACKET_MAGIC, PACKET_MAGIC + sizeof(PACKET_MAGIC), bytes.begin()) ||
+        bytes[4] != PACKET_VERSION)
+    {
+        return;
+    }
+
+    int ack = readI32(&bytes[5]);
+    int start = readI32(&bytes[9]);
+    size_t count = bytes[13];
+    if (bytes.size() != PACKET_HEADER_SIZE + count * 2)
+    {
+        return;
+    }
+
+    // Drop local inputs the peer already has
+    while (unackedLocalFrame <= ack && !unackedLocalInputs.empty())
+    {
+        unackedLocalInputs.pop_front();
+        unackedLocalFrame++;
+    }
+
+    // Inputs must be confirmed in order; anything after a gap is resent later
+    for (size_t i = 0; i < count; i++)
+    {
+        int frameNumber = start + static_cast<int>(i);
+        if (frameNumber <= confirmedRemoteFrame)
+        {
+            continue;
+        }
+        if (frameNumber != confirmedRemoteFrame + 1)
+        {
+            break;
+        }
+
+        PlayerInput input;
+        input.buttons = static_cast<uint16_t>(bytes[PACKET_HEADER_SIZE + i * 2] |
+                                              (bytes[PACKET_HEADER_SIZE + i * 2 + 1] << 8));
+        confirmRemoteInput(frameNumber, input);
+    }
+}
+
+void RollbackSession::confirmRemoteInput(int frameNumber, const PlayerInput& input)
+{
+    // A frame that already ran on a wrong guess has to be simulated again
+    if (frameNumber < frame && firstMispredictedFrame < 0 &&
+        recordFor(frameNumber).inputs[remotePlayer].buttons != input.buttons)
+    {
+        firstMispredictedFrame = frameNumber;
+    }
+
+    if (remoteInputs.empty())
+    {
+        remoteInputsFrame = frameNumber;
+    }
+    remoteInputs.push_back(input);
+    confirmedRemoteFrame = frameNumber;
+    lastRemoteInput = input;
+}
+
+void RollbackSession::sendInputs()
+{
+    // Resend everything unacknowledged so lost packets are covered by later ones
+    size_t count = std::min(unackedLocalInputs.size(), MAX_INPUTS_PER_PACKET);
+
+    packet.clear();
+    packet.insert(packet.end(), PACKET_MAGIC, PACKET_MAGIC + sizeof(PACKET_MAGIC));
+    packet.push_back(PACKET_VERSION);
+    writeI32(packet, confirmedRemoteFrame);
+    writeI32(packet, unackedLocalFrame);
+    packet.push_back(static_cast<uint8_t>(count));
+    for (size_t i = 0; i < count; i++)
+    {
+        uint16_t buttons = unackedLocalInputs[i].buttons;
+        packet.push_back(static_cast<uint8_t>(buttons));
+        packet.push_back(static_cast<uint8_t>(buttons >> 8));
+    }
+
+    transport.send(packet);
+}
@@ -0,0 +1,233 @@
+#include "../../include/net/UdpTransport.h"
+#include <cstring>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    const size_t MAX_DATAGRAM_SIZE = 1500;
+
+#ifdef _WIN32
+    typedef SOCKET NativeSocket;
+    const NativeSocket NO_SOCKET = INVALID_SOCKET;
+
+    bool initSockets()
+    {
+        WSADATA data;
+        return WSAStartup(MAKEWORD(2, 2), &data) == 0;
+    }
+
+    void shutdownSockets()
+    {
+        WSACleanup();
+    }
+
+    void closeSocket(NativeSocket s)
+    {
+        closesocket(s);
+    }
+
+    bool makeNonBlocking(NativeSocket s)
+    {
+        u_long nonBlocking = 1;
+        return ioctlsocket(s, FIONBIO, &nonBlocking) == 0;
+    }
+#else
+    typedef int NativeSocket;
+    const NativeSocket NO_SOCKET = -1;
+
+    bool initSockets()
+    {
+        return true;
+    }
+
+    void shutdownSockets()
+    {
+    }
+
+    void closeSocket(NativeSocket s)
+    {
+        ::close(s);
+    }
+
+    bool makeNonBlocking(NativeSocket s)
+    {
+        int flags = fcntl(s, F_GETFL, 0);
+        return flags >= 0 && fcntl(s, F_SETFL, flags | O_NONBLOCK) == 0;
+    }
+#endif
+
+    NativeSocket nativeSocket(std::intptr_t handle)
+    {
+        return static_cast<NativeSocket>(handle);
+    }
+}
+
+UdpTransport::UdpTransport()
+    : socketHandle(-1), random(0)
+{
+}
+
+UdpTransport::~UdpTransport()
+{
+    close();
+}
+
+bool UdpTransport::open(uint16_t localPort, const std::string& remoteHost, uint16_t remotePort)
+{
+    close();
+
+    if (!initSockets())
+    {
+        return false;
+    }
+
+    // Resolve the peer first so a bad host leaves nothing half open
+    addrinfo hints;
+    std::memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_DGRAM;
+
+    addrinfo* resolved = nullptr;
+    if (getaddrinfo(remoteHost.c_str(), nullptr, &hints, &resolved) != 0 || !resolved)
+    {
+        shutdownSockets();
+        return false;
+    }
+
+    sockaddr_in remote;
+    std::memcpy(&remote, resolved->ai_addr, sizeof(remote));
+    remote.sin_port = htons(remotePort);
+    freeaddrinfo(resolved);
+
+    NativeSocket s = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (s == NO_SOCKET)
+    {
+        shutdownSockets();
+        return false;
+    }
+
+    sockaddr_in local;
+    std::memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    local.sin_port = htons(localPort);
+
+    if (bind(s, reinterpret_cast<sockaddr*>(&local), sizeof(local)) != 0 || !makeNonBlocking(s))
+    {
+        closeSocket(s);
+        shutdownSockets();
+        return false;
+    }
+
+    socketHandle = static_cast<std::intptr_t>(s);
+    remoteAddress.assign(reinterpret_cast<uint8_t*>(&remote), reinterpret_cast<uint8_t*>(&remote) + sizeof(remote));
+
+    // Different per port so both ends of a localhost test do not drop in lockstep
+    random.seed(localPort);
+    return true;
+}
+
+void UdpTransport::close()
+{
+    if (!isOpen())
+    {
+        return;
+    }
+
+    closeSocket(nativeSocket(socketHandle));
+    shutdownSockets();
+    socketHandle = -1;
+    remoteAddress.clear();
+    outgoing.clear();
+}
+
+bool UdpTransport::isOpen() const
+{
+    return socketHandle != -1;
+}
+
+void UdpTransport::setConditions(const NetworkConditions& networkConditions)
+{
+    conditions = networkConditions;
+}
+
+void UdpTransport::send(const std::vector<uint8_t>& packet)
+{
+    if (!isOpen())
+    {
+        return;
+    }
+
+    // Emulated loss
+    if (conditions.lossRate > 0.0f && random.unit() < conditions.lossRate)
+    {
+        return;
+    }
+
+    int delayMs = conditions.delayMs;
+    if (conditions.jitterMs > 0)
+    {
+        delayMs += random.range(0, conditions.jitterMs);
+    }
+
+    if (delayMs <= 0)
+    {
+        sendNow(packet);
+        return;
+    }
+
+    outgoing.push_back({Clock::now() + std::chrono::milliseconds(delayMs), packet});
+}
+
+void UdpTransport::update()
+{
+    // Jitter can make later packets due first, so check every queued one
+    Clock::time_point now = Clock::now();
+    for (size_t i = 0; i < outgoing.size(); i++)
+    {
+        if (outgoing[i].sendAt <= now)
+        {
+            sendNow(outgoing[i].bytes);
+            outgoing.erase(outgoing.begin() + i);
+            i--;
+        }
+    }
+}
+
+bool UdpTransport::receive(std::vector<uint8_t>& packet)
+{
+    if (!isOpen())
+    {
+        return false;
+    }
+
+    packet.resize(MAX_DATAGRAM_SIZE);
+    int received = static_cast<int>(recvfrom(nativeSocket(socketHandle), reinterpret_cast<char*>(packet.data()),
+                                             static_cast<int>(packet.size()), 0, nullptr, nullptr));
+    if (received <= 0)
+    {
+        packet.clear();
+        return false;
+    }
+
+    packet.resize(received);
+    return true;
+}
+
+void UdpTransport::sendNow(const std::vector<uint8_t>& packet)
+{
+    sendto(nativeSocket(socketHandle), reinterpret_cast<const char*>(packet.data()), static_cast<int>(packet.size()), 0,
+           reinterpret_cast<const sockaddr*>(remoteAddress.data()), static_cast<int>(remoteAddress.size()));
+}
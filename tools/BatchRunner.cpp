@@ -0,0 +1,358 @@
+// vibester_batch: runs headless AI-vs-AI matches on every core and writes per-match
+// results plus per-preset totals as CSV or JSON.
+//
+// Usage: vibester_batch [--matches N] [--threads N] [--seed S] [--stocks N]
+//                       [--max-frames N] [--p1 presets] [--p2 presets]
+//                       [--csv file] [--json file]
+//
+// Presets are easy, medium, hard or expert (comma separated for a round robin).
+// Match i uses seed S + i, so any single match can be rerun on its own.
+
+#include "World.h"
+#include "AIConfig.h"
+#include "EnhancedAIController.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    const int MATCH_PLAYERS = 2;
+
+    struct Preset {
+        const char* name;
+        float difficulty;
+    };
+
+    // Same tiers as the title screen's difficulty keys
+    const Preset PRESETS[] = {
+        {"easy", 0.2f},
+        {"medium", 0.5f},
+        {"hard", 0.8f},
+        {"expert", 1.0f},
+    };
+
+    struct Options {
+        int matches = 1000;
+        int threads = 0;
+        uint64_t seed = 1;
+        int stocks = 3;
+        int maxFrames = 60 * 60 * 8; // 8 minutes of game time
+        std::vector<std::string> p1Presets = {"hard"};
+        std::vector<std::string> p2Presets = {"hard"};
+        std::string csvPath;
+        std::string jsonPath;
+    };
+
+    struct MatchJob {
+        int index;
+        uint64_t seed;
+        std::string presets[MATCH_PLAYERS];
+    };
+
+    struct MatchResult {
+        int frames;
+        int winner; // -1 for a draw
+        bool timedOut;
+        int stocks[MATCH_PLAYERS];
+        PlayerStats stats[MATCH_PLAYERS];
+    };
+
+    // Totals for one preset over every match it played
+    struct PresetTotals {
+        int matches = 0;
+        int wins = 0;
+        int KOs = 0;
+        int falls = 0;
+        int selfDestructs = 0;
+        double damageDealt = 0.0;
+        double damageTaken = 0.0;
+        long long frames = 0;
+    };
+
+    bool findPreset(const std::string& name, float& difficulty)
+    {
+        for (const Preset& preset : PRESETS)
+        {
+            if (name == preset.name)
+            {
+                difficulty = preset.difficulty;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::vector<std::string> splitList(const std::string& text)
+    {
+        std::vector<std::string> items;
+        std::stringstream stream(text);
+        std::string item;
+        while (std::getline(stream, item, ','))
+        {
+            if (!item.empty())
+            {
+                items.push_back(item);
+            }
+        }
+        return items;
+    }
+
+    bool parseOptions(int argc, char** argv, Options& options)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            std::string name = argv[i];
+            if (i + 1 >= argc)
+            {
+                std::cerr << "Missing value for " << name << std::endl;
+                return false;
+            }
+
+            std::string value = argv[++i];
+            if (name == "--matches") options.matches = std::atoi(value.c_str());
+            else if (name == "--threads") options.threads = std::atoi(value.c_str());
+            else if (name == "--seed") options.seed = std::strtoull(value.c_str(), nullptr, 10);
+            else if (name == "--stocks") options.stocks = std::atoi(value.c_str());
+            else if (name == "--max-frames") options.maxFrames = std::atoi(value.c_str());
+            else if (name == "--p1") options.p1Presets = splitList(value);
+            else if (name == "--p2") options.p2Presets = splitList(value);
+            else if (name == "--csv") options.csvPath = value;
+            else if (name == "--json") options.jsonPath = value;
+            else
+            {
+                std::cerr << "Unknown option " << name << std::endl;
+                return false;
+            }
+        }
+
+        if (options.matches <= 0 || options.stocks <= 0 || options.stocks > 255 || options.maxFrames <= 0 ||
+            options.p1Presets.empty() || options.p2Presets.empty())
+        {
+            std::cerr << "Invalid match settings" << std::endl;
+            return false;
+        }
+
+        for (const auto& list : {options.p1Presets, options.p2Presets})
+        {
+            for (const std::string& name : list)
+            {
+                float difficulty;
+                if (!findPreset(name, difficulty))
+                {
+                    std::cerr << "Unknown preset " << name << " (use easy, medium, hard or expert)" << std::endl;
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    // Each call owns its world, so matches share nothing but read-only options
+    MatchResult runMatch(const MatchJob& job, const Options& options)
+    {
+        World world;
+
+        ReplayHeader header;
+        header.seed = job.seed;
+        header.stageId = REPLAY_STAGE_DEFAULT;
+        header.stockCount = static_cast<uint8_t>(options.stocks);
+        world.initFromReplay(header);
+
+        for (int slot = 0; slot < MATCH_PLAYERS; slot++)
+        {
+            float difficulty = 0.0f;
+            findPreset(job.presets[slot], difficulty);
+            world.enableAI(slot, 1 - slot, AIConfig(difficulty));
+        }
+
+        // AI slots ignore inputs
+        std::vector<PlayerInput> noInputs;
+        while (!world.isMatchOver() && world.frame < options.maxFrames)
+        {
+            world.step(noInputs);
+        }
+
+        MatchResult result;
+        result.frames = world.frame;
+        result.timedOut = !world.isMatchOver();
+        for (int slot = 0; slot < MATCH_PLAYERS; slot++)
+        {
+            result.stocks[slot] = world.players[slot]->stocks;
+            result.stats[slot] = world.stats[slot];
+        }
+
+        // Most stocks wins; a timeout with equal stocks is a draw
+        result.winner = -1;
+        if (result.stocks[0] != result.stocks[1])
+        {
+            result.winner = result.stocks[0] > result.stocks[1] ? 0 : 1;
+        }
+
+        return result;
+    }
+
+    void writeCsv(std::ostream& out, const std::vector<MatchJob>& jobs, const std::vector<MatchResult>& results)
+    {
+        out << "match,seed,frames,timed_out,winner";
+        for (int slot = 1; slot <= MATCH_PLAYERS; slot++)
+        {
+            out << ",p" << slot << "_preset,p" << slot << "_stocks,p" << slot << "_kos,p" << slot << "_falls"
+                << ",p" << slot << "_self_destructs,p" << slot << "_damage_dealt,p" << slot << "_damage_taken";
+        }
+        out << "\n";
+
+        for (size_t i = 0; i < jobs.size(); i++)
+        {
+            const MatchResult& result = results[i];
+            out << jobs[i].index << "," << jobs[i].seed << "," << result.frames << ","
+                << (result.timedOut ? 1 : 0) << "," << (result.winner >= 0 ? result.winner + 1 : 0);
+            for (int slot = 0; slot < MATCH_PLAYERS; slot++)
+            {
+                const PlayerStats& stats = result.stats[slot];
+                out << "," << jobs[i].presets[slot] << "," << result.stocks[slot] << "," << stats.KOs << ","
+                    << stats.falls << "," << stats.selfDestructs << "," << stats.damageDealt << "," << stats.damageTaken;
+            }
+            out << "\n";
+        }
+    }
+
+    void writeJson(std::ostream& out, const std::vector<MatchJob>& jobs, const std::vector<MatchResult>& results,
+                   const std::map<std::string, PresetTotals>& totals)
+    {
+        out << "{\n  \"matches\": [\n";
+        for (size_t i = 0; i < jobs.size(); i++)
+        {
+            const MatchResult& result = results[i];
+            out << "    {\"match\": " << jobs[i].index << ", \"seed\": " << jobs[i].seed
+                << ", \"frames\": " << result.frames << ", \"timed_out\": " << (result.timedOut ? "true" : "false")
+                << ", \"winner\": " << (result.winner >= 0 ? result.winner + 1 : 0) << ", \"players\": [";
+            for (int slot = 0; slot < MATCH_PLAYERS; slot++)
+            {
+                const PlayerStats& stats = result.stats[slot];
+                out << (slot > 0 ? ", " : "") << "{\"preset\": \"" << jobs[i].presets[slot] << "\", \"stocks\": "
+                    << result.stocks[slot] << ", \"kos\": " << stats.KOs << ", \"falls\": " << stats.falls
+                    << ", \"self_destructs\": " << stats.selfDestructs << ", \"damage_dealt\": " << stats.damageDealt
+                    << ", \"damage_taken\": " << stats.damageTaken << "}";
+            }
+            out << "]}" << (i + 1 < jobs.size() ? "," : "") << "\n";
+        }
+
+        out << "  ],\n  \"presets\": {\n";
+        size_t written = 0;
+        for (const auto& entry : totals)
+        {
+            const PresetTotals& t = entry.second;
+            out << "    \"" << entry.first << "\": {\"matches\": " << t.matches << ", \"wins\": " << t.wins
+                << ", \"kos\": " << t.KOs << ", \"falls\": " << t.falls << ", \"self_destructs\": " << t.selfDestructs
+                << ", \"damage_dealt\": " << t.damageDealt << ", \"damage_taken\": " << t.damageTaken
+                << ", \"frames\": " << t.frames << "}" << (++written < totals.size() ? "," : "") << "\n";
+        }
+        out << "  }\n}\n";
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        return 1;
+    }
+
+    int threadCount = options.threads > 0 ? options.threads : static_cast<int>(std::thread::hardware_concurrency());
+    threadCount = std::max(1, std::min(threadCount, options.matches));
+
+    // Every p1 preset meets every p2 preset in turn
+    std::vector<MatchJob> jobs(options.matches);
+    for (int i = 0; i < options.matches; i++)
+    {
+        int pairing = i % (options.p1Presets.size() * options.p2Presets.size());
+        jobs[i].index = i;
+        jobs[i].seed = options.seed + static_cast<uint64_t>(i);
+        jobs[i].presets[0] = options.p1Presets[pairing % options.p1Presets.size()];
+        jobs[i].presets[1] = options.p2Presets[pairing / options.p1Presets.size()];
+    }
+
+    // Workers pull the next match index until none are left; each result has its own slot
+    std::vector<MatchResult> results(options.matches);
+    std::atomic<int> nextJob(0);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threadCount; t++)
+    {
+        workers.emplace_back([&]()
+        {
+            for (int i = nextJob++; i < options.matches; i = nextJob++)
+            {
+                results[i] = runMatch(jobs[i], options);
+            }
+        });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    // Per-preset totals
+    std::map<std::string, PresetTotals> totals;
+    long long totalFrames = 0;
+    for (int i = 0; i < options.matches; i++)
+    {
+        const MatchResult& result = results[i];
+        totalFrames += result.frames;
+        for (int slot = 0; slot < MATCH_PLAYERS; slot++)
+        {
+            PresetTotals& t = totals[jobs[i].presets[slot]];
+            t.matches++;
+            t.wins += result.winner == slot ? 1 : 0;
+            t.KOs += result.stats[slot].KOs;
+            t.falls += result.stats[slot].falls;
+            t.selfDestructs += result.stats[slot].selfDestructs;
+            t.damageDealt += result.stats[slot].damageDealt;
+            t.damageTaken += result.stats[slot].damageTaken;
+            t.frames += result.frames;
+        }
+    }
+
+    if (!options.csvPath.empty())
+    {
+        std::ofstream file(options.csvPath);
+        writeCsv(file, jobs, results);
+    }
+    if (!options.jsonPath.empty())
+    {
+        std::ofstream file(options.jsonPath);
+        writeJson(file, jobs, results, totals);
+    }
+    if (options.csvPath.empty() && options.jsonPath.empty())
+    {
+        writeCsv(std::cout, jobs, results);
+    }
+
+    // Summary on stderr so it never mixes with CSV on stdout
+    std::fprintf(stderr, "%d matches on %d threads in %.2f s (%.0f matches/s, %.0f ticks/s)\n",
+                 options.matches, threadCount, elapsed.count(), options.matches / elapsed.count(),
+                 totalFrames / elapsed.count());
+    for (const auto& entry : totals)
+    {
+        const PresetTotals& t = entry.second;
+        std::fprintf(stderr, "  %-8s played %6d  won %6d  KOs %7d  SDs %6d  dmg dealt %10.0f  taken %10.0f\n",
+                     entry.first.c_str(), t.matches, t.wins, t.KOs, t.selfDestructs, t.damageDealt, t.damageTaken);
+    }
+
+    return 0;
+}
@@ -0,0 +1,310 @@
+// vibester_determinism: plays one input stream headless and writes the world's
+// state hash after every frame, so two builds (different compilers, flags or
+// machines) can be checked for bit-identical simulation.
+//
+// Usage: vibester_determinism [--replay file] [--seed S] [--frames N]
+//                             [--rollback-window N] [--out file] [--compare file]
+//
+// The inputs come from a replay, or are generated from the seed: both players
+// hold random button combinations for random stretches, with no AI. Each run
+// also rolls back every rollback-window frames (default 8, 0 to skip) and
+// re-simulates them from a snapshot, as netplay does, checking the hashes come
+// out the same.
+//
+// Typical use: build twice (say -O0 and -O2 -mfpmath=387 -ffast-math, which
+// catches any float left in the simulation, or two compilers, with
+// VIBESTER_FIXED_POINT on), run one with --out hashes.txt and the other with
+// --compare hashes.txt. The exit status is 1 at the first frame that differs.
+
+#include "World.h"
+#include "Cosmetics.h"
+#include "Random.h"
+#include "Replay.h"
+#include "Snapshot.h"
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    const int MATCH_PLAYERS = 2;
+
+    // Generated streams hold each combination for this many frames
+    const int MIN_HOLD_FRAMES = 4;
+    const int MAX_HOLD_FRAMES = 30;
+
+#ifdef VIBESTER_FIXED_POINT
+    const char* const NUMERIC_MODE = "fixed";
+#else
+    const char* const NUMERIC_MODE = "float";
+#endif
+
+    struct Options {
+        std::string replayPath;
+        uint64_t seed = 1;
+        int frames = 60 * 60 * 2;
+        int rollbackWindow = 8;
+        std::string outPath;
+        std::string comparePath;
+    };
+
+    bool parseOptions(int argc, char** argv, Options& options)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            std::string name = argv[i];
+            if (i + 1 >= argc)
+            {
+                std::cerr << "Missing value for " << name << std::endl;
+                return false;
+            }
+
+            std::string value = argv[++i];
+            if (name == "--replay") options.replayPath = value;
+            else if (name == "--seed") options.seed = std::strtoull(value.c_str(), nullptr, 10);
+            else if (name == "--frames") options.frames = std::atoi(value.c_str());
+            else if (name == "--rollback-window") options.rollbackWindow = std::atoi(value.c_str());
+            else if (name == "--out") options.outPath = value;
+            else if (name == "--compare") options.comparePath = value;
+            else
+            {
+                std::cerr << "Unknown option " << name << std::endl;
+                return false;
+            }
+        }
+
+        if (options.frames <= 0 || options.rollbackWindow < 0)
+        {
+            std::cerr << "Invalid frame counts" << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    // A movement direction plus at most one action, so characters actually
+    // run, jump, attack and shield rather than mashing everything at once
+    uint16_t randomButtons(Random& random)
+    {
+        const uint16_t DIRECTIONS[] = {0, InputButton::LEFT, InputButton::RIGHT, InputButton::UP, InputButton::DOWN};
+        const uint16_t ACTIONS[] = {0, 0, InputButton::ATTACK, InputButton::SPECIAL, InputButton::SMASH,
+                                    InputButton::SHIELD, InputButton::GRAB};
+        return DIRECTIONS[random.range(0, 4)] | ACTIONS[random.range(0, 6)];
+    }
+
+    std::vector<std::vector<PlayerInput>> generateInputs(uint64_t seed, int frames)
+    {
+        Random random(seed ^ 0xD37E2A11ULL);
+        std::vector<std::vector<PlayerInput>> inputs(frames, std::vector<PlayerInput>(MATCH_PLAYERS));
+        for (int player = 0; player < MATCH_PLAYERS; player++)
+        {
+            int frame = 0;
+            while (frame < frames)
+            {
+                PlayerInput held(randomButtons(random));
+                int hold = random.range(MIN_HOLD_FRAMES, MAX_HOLD_FRAMES);
+                for (int i = 0; i < hold && frame < frames; i++, frame++)
+                {
+                    inputs[frame][player] = held;
+                }
+            }
+        }
+        return inputs;
+    }
+
+    bool loadInputs(const Options& options, ReplayHeader& header, std::vector<std::vector<PlayerInput>>& inputs)
+    {
+        if (options.replayPath.empty())
+        {
+            header.seed = options.seed;
+            header.stageId = REPLAY_STAGE_DEFAULT;
+            header.playerCount = MATCH_PLAYERS;
+            header.stockCount = 3;
+            header.frameCount = static_cast<uint32_t>(options.frames);
+            inputs = generateInputs(options.seed, options.frames);
+            return true;
+        }
+
+        ReplayPlayer replay;
+        if (!replay.load(options.replayPath))
+        {
+            std::cerr << "Could not read replay " << options.replayPath << std::endl;
+            return false;
+        }
+
+        header = replay.getHeader();
+        while (!replay.isFinished())
+        {
+            inputs.push_back(replay.next());
+        }
+        return true;
+    }
+
+    // Every window frames, go back window frames and run them again from the
+    // snapshot taken there; returns the first frame whose hash came out
+    // different, or -1
+    int checkRollback(World& world, const std::vector<std::vector<PlayerInput>>& inputs,
+                      const std::vector<uint64_t>& hashes, int window)
+    {
+        std::vector<uint8_t> snapshot;
+        for (int start = 0; start + window <= static_cast<int>(inputs.size()); start += window)
+        {
+            Snapshot::save(world, snapshot, Snapshot::SIMULATION_ONLY);
+
+            for (int frame = start; frame < start + window; frame++)
+            {
+                world.step(inputs[frame]);
+            }
+
+            // Re-simulated frames were already shown, so no cosmetics, as in RollbackSession
+            Snapshot::restore(world, snapshot);
+            CosmeticsScope cosmetics(false);
+            for (int frame = start; frame < start + window; frame++)
+            {
+                world.step(inputs[frame]);
+                if (world.stateHash() != hashes[frame])
+                {
+                    return frame;
+                }
+            }
+        }
+        return -1;
+    }
+
+    bool readHashes(const std::string& path, std::string& mode, std::vector<uint64_t>& hashes)
+    {
+        std::ifstream file(path);
+        if (!file)
+        {
+            return false;
+        }
+
+        std::string line;
+        while (std::getline(file, line))
+        {
+            if (line.empty())
+            {
+                continue;
+            }
+            if (line[0] == '#')
+            {
+                std::istringstream header(line);
+                std::string marker, program, format;
+                header >> marker >> program >> format >> mode;
+                continue;
+            }
+
+            int frame;
+            unsigned long long value;
+            if (std::sscanf(line.c_str(), "%d %llx", &frame, &value) != 2 || frame != static_cast<int>(hashes.size()))
+            {
+                return false;
+            }
+            hashes.push_back(value);
+        }
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        return 1;
+    }
+
+    ReplayHeader header;
+    std::vector<std::vector<PlayerInput>> inputs;
+    if (!loadInputs(options, header, inputs))
+    {
+        return 1;
+    }
+
+    World world;
+    if (!world.initFromReplay(header))
+    {
+        std::cerr << "Unknown stage in replay" << std::endl;
+        return 1;
+    }
+
+    // Hash after every frame; frame i is the state once inputs[i] has run
+    std::vector<uint64_t> hashes;
+    hashes.reserve(inputs.size());
+    for (const std::vector<PlayerInput>& frameInputs : inputs)
+    {
+        world.step(frameInputs);
+        hashes.push_back(world.stateHash());
+    }
+    uint64_t finalHash = hashes.empty() ? 0 : hashes.back();
+    std::printf("%s physics, %zu frames, final hash %016" PRIx64 "\n", NUMERIC_MODE, hashes.size(), finalHash);
+
+    int status = 0;
+    if (options.rollbackWindow > 0)
+    {
+        World rerun;
+        rerun.initFromReplay(header);
+        int diverged = checkRollback(rerun, inputs, hashes, options.rollbackWindow);
+        if (diverged >= 0)
+        {
+            std::printf("rollback: re-simulated frame %d differs from the first run\n", diverged);
+            status = 1;
+        }
+        else
+        {
+            std::printf("rollback: every %d-frame window re-simulated identically\n", options.rollbackWindow);
+        }
+    }
+
+    if (!options.outPath.empty())
+    {
+        std::ofstream out(options.outPath);
+        out << "# vibester state-hashes " << NUMERIC_MODE << "\n";
+        char line[64];
+        for (size_t frame = 0; frame < hashes.size(); frame++)
+        {
+            std::snprintf(line, sizeof(line), "%zu %016" PRIx64 "\n", frame, hashes[frame]);
+            out << line;
+        }
+    }
+
+    if (!options.comparePath.empty())
+    {
+        std::string otherMode;
+        std::vector<uint64_t> other;
+        if (!readHashes(options.comparePath, otherMode, other))
+        {
+            std::cerr << "Could not read hashes from " << options.comparePath << std::endl;
+            return 1;
+        }
+        if (otherMode != NUMERIC_MODE)
+        {
+            std::printf("note: %s was written by a %s build; float and fixed hashes never match\n",
+                        options.comparePath.c_str(), otherMode.c_str());
+        }
+
+        size_t common = std::min(other.size(), hashes.size());
+        for (size_t frame = 0; frame < common; frame++)
+        {
+            if (other[frame] != hashes[frame])
+            {
+                std::printf("compare: first difference at frame %zu\n", frame);
+                return 1;
+            }
+        }
+        if (other.size() != hashes.size())
+        {
+            std::printf("compare: %zu frames match, but the runs have %zu and %zu frames\n", common,
+                        other.size(), hashes.size());
+            return 1;
+        }
+        std::printf("compare: all %zu frames match\n", common);
+    }
+
+    return status;
+}
@@ -0,0 +1,208 @@
+// vibester_stress: builds procedural stress scenes over a grid of character and
+// platform counts and logs the sustained tick time of each, to find where the
+// per-character platform loops and the all-pairs hit check stop scaling.
+//
+// Usage: vibester_stress [--characters list] [--platforms list] [--ticks N]
+//                        [--warmup N] [--seed S] [--projectile-interval N]
+//                        [--explosion-interval N] [--moving-fraction F]
+//                        [--particle-budget N] [--csv file]
+//
+// Lists are comma separated, e.g. --characters 8,16,32,64 --platforms 100,400.
+
+#include "World.h"
+#include "StressScene.h"
+#include "GameConfig.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct Options {
+        std::vector<int> characters = {8, 16, 32, 64};
+        std::vector<int> platforms = {100, 400};
+        int ticks = 1200;
+        int warmup = 120;
+        int particleBudget = PARTICLE_BUDGET;
+        StressConfig scene;
+        std::string csvPath;
+    };
+
+    struct SceneResult {
+        int characters;
+        int platforms;
+        double meanMs;
+        double p50Ms;
+        double p99Ms;
+        double maxMs;
+        double attacks;    // Mean live hitboxes and projectiles per tick
+        double particles;  // Mean live particles per tick
+    };
+
+    std::vector<int> splitCounts(const std::string& text)
+    {
+        std::vector<int> counts;
+        std::stringstream stream(text);
+        std::string item;
+        while (std::getline(stream, item, ','))
+        {
+            if (!item.empty())
+            {
+                counts.push_back(std::atoi(item.c_str()));
+            }
+        }
+        return counts;
+    }
+
+    bool parseOptions(int argc, char** argv, Options& options)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            std::string name = argv[i];
+            if (i + 1 >= argc)
+            {
+                std::cerr << "Missing value for " << name << std::endl;
+                return false;
+            }
+
+            std::string value = argv[++i];
+            if (name == "--characters") options.characters = splitCounts(value);
+            else if (name == "--platforms") options.platforms = splitCounts(value);
+            else if (name == "--ticks") options.ticks = std::atoi(value.c_str());
+            else if (name == "--warmup") options.warmup = std::atoi(value.c_str());
+            else if (name == "--seed") options.scene.seed = std::strtoull(value.c_str(), nullptr, 10);
+            else if (name == "--projectile-interval") options.scene.projectileInterval = std::atoi(value.c_str());
+            else if (name == "--explosion-interval") options.scene.explosionInterval = std::atoi(value.c_str());
+            else if (name == "--moving-fraction") options.scene.movingFraction = static_cast<float>(std::atof(value.c_str()));
+            else if (name == "--particle-budget") options.particleBudget = std::atoi(value.c_str());
+            else if (name == "--csv") options.csvPath = value;
+            else
+            {
+                std::cerr << "Unknown option " << name << std::endl;
+                return false;
+            }
+        }
+
+        bool countsValid = !options.characters.empty() && !options.platforms.empty();
+        for (int count : options.characters) countsValid = countsValid && count >= 2;
+        for (int count : options.platforms) countsValid = countsValid && count >= 1;
+        if (!countsValid || options.ticks <= 0 || options.warmup < 0 ||
+            options.scene.projectileInterval < 0 || options.scene.explosionInterval < 0 || options.particleBudget < 0 ||
+            options.scene.movingFraction < 0.0f || options.scene.movingFraction > 1.0f)
+        {
+            std::cerr << "Invalid stress settings" << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    double percentile(const std::vector<double>& sorted, double fraction)
+    {
+        size_t index = static_cast<size_t>(fraction * (sorted.size() - 1) + 0.5);
+        return sorted[std::min(index, sorted.size() - 1)];
+    }
+
+    SceneResult runScene(int characters, int platforms, const Options& options)
+    {
+        StressConfig config = options.scene;
+        config.characters = characters;
+        config.platforms = platforms;
+
+        World world;
+        StressScene::build(world, config);
+        world.vfx.particles.setBudget(options.particleBudget);
+
+        // AI slots ignore inputs
+        std::vector<PlayerInput> noInputs;
+        for (int i = 0; i < options.warmup; i++)
+        {
+            StressScene::drive(world, config);
+            world.step(noInputs);
+        }
+
+        std::vector<double> tickMs;
+        tickMs.reserve(options.ticks);
+        double attacks = 0.0;
+        double particles = 0.0;
+        for (int i = 0; i < options.ticks; i++)
+        {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            StressScene::drive(world, config);
+            world.step(noInputs);
+            std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+            tickMs.push_back(elapsed.count());
+
+            particles += world.vfx.particles.size();
+            attacks += world.projectiles.size();
+            for (Character* character : world.players)
+            {
+                attacks += character->attacks.size();
+            }
+        }
+
+        SceneResult result;
+        result.characters = characters;
+        result.platforms = platforms;
+        double total = 0.0;
+        for (double ms : tickMs) total += ms;
+        result.meanMs = total / tickMs.size();
+        std::sort(tickMs.begin(), tickMs.end());
+        result.p50Ms = percentile(tickMs, 0.50);
+        result.p99Ms = percentile(tickMs, 0.99);
+        result.maxMs = tickMs.back();
+        result.attacks = attacks / options.ticks;
+        result.particles = particles / options.ticks;
+        return result;
+    }
+
+    void writeCsv(std::ostream& out, const std::vector<SceneResult>& results)
+    {
+        out << "characters,platforms,mean_ms,p50_ms,p99_ms,max_ms,ticks_per_second,attacks,particles\n";
+        for (const SceneResult& r : results)
+        {
+            out << r.characters << "," << r.platforms << "," << r.meanMs << "," << r.p50Ms << "," << r.p99Ms << ","
+                << r.maxMs << "," << 1000.0 / r.meanMs << "," << r.attacks << "," << r.particles << "\n";
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        return 1;
+    }
+
+    std::vector<SceneResult> results;
+    std::printf("%10s %10s %10s %10s %10s %10s %12s %9s %10s\n", "characters", "platforms", "mean ms", "p50 ms",
+                "p99 ms", "max ms", "ticks/s", "attacks", "particles");
+    for (int platforms : options.platforms)
+    {
+        for (int characters : options.characters)
+        {
+            SceneResult r = runScene(characters, platforms, options);
+            results.push_back(r);
+
+            // Flag ticks that would no longer fit a 60 Hz frame on their own
+            std::printf("%10d %10d %10.3f %10.3f %10.3f %10.3f %12.0f %9.1f %10.0f%s\n", r.characters, r.platforms,
+                        r.meanMs, r.p50Ms, r.p99Ms, r.maxMs, 1000.0 / r.meanMs, r.attacks, r.particles,
+                        r.p99Ms > SIMULATION_TICK_SECONDS * 1000.0f ? "  over budget" : "");
+            std::fflush(stdout);
+        }
+    }
+
+    if (!options.csvPath.empty())
+    {
+        std::ofstream file(options.csvPath);
+        writeCsv(file, results);
+    }
+
+    return 0;
+}